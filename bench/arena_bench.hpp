@@ -0,0 +1,78 @@
+#ifndef BENCH_ARENA_BENCH_HPP_
+#define BENCH_ARENA_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_arena_bench_hpp_
+{
+
+template <typename String, template <typename> class Vector>
+struct Item
+{
+    String name;
+    Vector<String> tags;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Item::name, "name"),
+        bound::property(&Item::tags, "tags"));
+};
+
+template <typename String, template <typename> class Vector>
+struct Request
+{
+    int id;
+    String user;
+    Vector<Item<String, Vector>> items;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Request::id, "id"),
+        bound::property(&Request::user, "user"),
+        bound::property(&Request::items, "items"));
+};
+
+template <typename T>
+using HeapVector = std::vector<T>;
+
+// Many small strings and vectors, each one an allocation
+std::string Document(std::size_t count)
+{
+    std::string json = "{\"id\":1,\"user\":\"a user whose name does not fit inline\",\"items\":[";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::string id = std::to_string(i);
+        json += (i > 0 ? "," : "");
+        json += "{\"name\":\"an item name that is long enough " + id +
+                "\",\"tags\":[\"first tag of the item\",\"second tag of the item\"]}";
+    }
+    json += "]}";
+    return json;
+}
+
+void Run()
+{
+    const std::string json = Document(1000);
+    const std::size_t iterations = 200;
+
+    bench::Report("global allocator", bench::Measure(iterations, [&] {
+                      auto status = bound::CreateWithJson<Request<std::string, HeapVector>>(json);
+                      bench::sink += status.instance.items.size();
+                  }),
+                  "request");
+
+    bound::Arena arena;
+    bench::Report("arena, reset per request", bench::Measure(iterations, [&] {
+                      {
+                          bound::ArenaScope scope{arena};
+                          auto status = bound::CreateWithJson<Request<bound::ArenaString, bound::ArenaVector>>(json);
+                          bench::sink += status.instance.items.size();
+                      }
+                      arena.Reset();
+                  }),
+                  "request");
+}
+
+bench::Register arena{"arena", Run};
+
+} // namespace bench_arena_bench_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef BENCH_BENCH_H_
+#define BENCH_BENCH_H_
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "bound/bound.h"
+
+namespace bench
+{
+
+struct Benchmark
+{
+    const char *name;
+    void (*run)();
+};
+
+inline std::vector<Benchmark> &Benchmarks()
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+// Registers a benchmark to be ran by main
+struct Register
+{
+    Register(const char *name, void (*run)())
+    {
+        Benchmarks().push_back(Benchmark{name, run});
+    }
+};
+
+// Written to so measured work is not optimized away
+static volatile std::size_t sink = 0;
+
+// Returns the average nanoseconds of one call to f
+template <typename F>
+double Measure(std::size_t iterations, F &&f)
+{
+    // Warm up caches and allocators
+    f();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        f();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+inline void Report(const std::string &label, double nanoseconds, const char *unit)
+{
+    printf("  %-52s %14.1f ns/%s\n", label.c_str(), nanoseconds, unit);
+}
+
+inline void ReportRate(const std::string &label, double nanoseconds, const char *unit)
+{
+    printf("  %-52s %14.0f %s/s\n", label.c_str(), 1e9 / nanoseconds, unit);
+}
+
+} // namespace bench
+
+#endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef BENCH_CREATE_MANY_BENCH_HPP_
+#define BENCH_CREATE_MANY_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_create_many_bench_hpp_
+{
+
+struct Message
+{
+    int id;
+    std::string topic;
+    double value;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Message::id, "id"),
+        bound::property(&Message::topic, "topic"),
+        bound::property(&Message::value, "value"));
+};
+
+void Run()
+{
+    std::vector<std::string> documents;
+    for (int i = 0; i < 10000; ++i)
+    {
+        documents.push_back("{\"id\":" + std::to_string(i) + ",\"topic\":\"t\",\"value\":1.5}");
+    }
+
+    bench::ReportRate("CreateWithJson loop", bench::Measure(50, [&] {
+                          std::vector<Message> messages;
+                          messages.reserve(documents.size());
+                          for (const auto &document : documents)
+                          {
+                              auto status = bound::CreateWithJson<Message>(document);
+                              bench::sink += status.success;
+                              messages.push_back(std::move(status.instance));
+                          }
+                          bench::sink += messages.size();
+                      }) / documents.size(),
+                      "doc");
+
+    std::vector<Message> messages;
+    bench::ReportRate("CreateManyWithJson", bench::Measure(50, [&] {
+                          bench::sink += bound::CreateManyWithJson(documents, messages).success;
+                          bench::sink += messages.size();
+                      }) / documents.size(),
+                      "doc");
+}
+
+bench::Register create_many{"create_many", Run};
+
+} // namespace bench_create_many_bench_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef BENCH_ERROR_BENCH_HPP_
+#define BENCH_ERROR_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_error_bench_hpp_
+{
+
+struct Message
+{
+    int id;
+    std::string name;
+    std::vector<int> values;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Message::id, "id"),
+        bound::property(&Message::name, "name"),
+        bound::property(&Message::values, "values"));
+};
+
+void Report(const char *label, const char *json)
+{
+    bound::ReadContext context;
+    Message message;
+    bench::Report(label, bench::Measure(200000, [&] {
+                      bench::sink += bound::UpdateWithJson(context, message, json).success;
+                  }),
+                  "doc");
+}
+
+void Run()
+{
+    Report("valid", "{\"id\":1,\"name\":\"alpha\",\"values\":[1,2,3]}");
+    Report("wrong type", "{\"id\":\"one\",\"name\":\"alpha\",\"values\":[1,2,3]}");
+    Report("out of range", "{\"id\":1e12,\"name\":\"alpha\",\"values\":[1,2,3]}");
+    Report("malformed", "{\"id\":1,\"name\":\"alpha\",\"values\":[1,2,}");
+
+    // The message is only formatted when asked for
+    bound::ReadContext context;
+    Message message;
+    bench::Report("wrong type, message formatted", bench::Measure(200000, [&] {
+                      bench::sink += bound::UpdateWithJson(context, message, "{\"id\":\"one\"}").error_message().size();
+                  }),
+                  "doc");
+}
+
+bench::Register error{"error", Run};
+
+} // namespace bench_error_bench_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef BENCH_FIELD_MASK_BENCH_HPP_
+#define BENCH_FIELD_MASK_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_field_mask_bench_hpp_
+{
+
+struct Line
+{
+    std::string sku;
+    int quantity;
+    double price;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Line::sku, "sku"),
+        bound::property(&Line::quantity, "quantity"),
+        bound::property(&Line::price, "price"));
+};
+
+struct Order
+{
+    int id;
+    std::string customer;
+    std::string status;
+    std::vector<Line> lines;
+    std::vector<std::string> history;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Order::id, "id"),
+        bound::property(&Order::customer, "customer"),
+        bound::property(&Order::status, "status"),
+        bound::property(&Order::lines, "lines"),
+        bound::property(&Order::history, "history"));
+};
+
+std::string Json(std::size_t count)
+{
+    std::string json = "{\"id\":42,\"customer\":\"ada\",\"status\":\"shipped\",\"lines\":[";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        json += (i > 0 ? "," : "");
+        json += "{\"sku\":\"sku-" + std::to_string(i) + "\",\"quantity\":3,\"price\":9.99}";
+    }
+    json += "],\"history\":[";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        json += (i > 0 ? "," : "");
+        json += "\"event " + std::to_string(i) + "\"";
+    }
+    return json + "]}";
+}
+
+constexpr bound::FieldMask<Order> kHeader{"id", "customer", "status"};
+
+void Run()
+{
+    const std::string json = Json(1000);
+    Order order;
+
+    bench::ReportRate("all fields", bench::Measure(200, [&] {
+                          bench::sink += bound::UpdateWithJson(order, json).success;
+                      }),
+                      "doc");
+
+    bench::ReportRate("header fields", bench::Measure(200, [&] {
+                          bench::sink += bound::UpdateWithJson(order, json, kHeader).success;
+                      }),
+                      "doc");
+
+    bound::FieldMask<Order> lines{"lines"};
+    bench::ReportRate("lines only", bench::Measure(200, [&] {
+                          bench::sink += bound::UpdateWithJson(order, json, lines).success;
+                      }),
+                      "doc");
+}
+
+bench::Register field_mask{"field_mask", Run};
+
+} // namespace bench_field_mask_bench_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,86 @@
+#ifndef BENCH_INCREMENTAL_BENCH_HPP_
+#define BENCH_INCREMENTAL_BENCH_HPP_
+
+#include <chrono>
+#include <thread>
+#include "bench.h"
+
+namespace bench_incremental_bench_hpp_
+{
+
+struct Item
+{
+    int id;
+    std::string name;
+    std::vector<double> values;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Item::id, "id"),
+        bound::property(&Item::name, "name"),
+        bound::property(&Item::values, "values"));
+};
+
+struct Body
+{
+    std::vector<Item> items;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Body::items, "items"));
+};
+
+std::string Document(std::size_t count)
+{
+    std::string json = "{\"items\":[";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::string id = std::to_string(i);
+        json += (i > 0 ? "," : "");
+        json += "{\"id\":" + id + ",\"name\":\"item " + id + "\",\"values\":[0.5,1.5,2.5,3.5]}";
+    }
+    json += "]}";
+    return json;
+}
+
+// Chunks arrive from the network with a gap between each
+template <typename F>
+void Receive(const std::string &json, std::size_t chunk_size, F &&on_chunk)
+{
+    for (std::size_t offset = 0; offset < json.size(); offset += chunk_size)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        on_chunk(json.data() + offset, std::min(chunk_size, json.size() - offset));
+    }
+}
+
+void Run()
+{
+    const std::string json = Document(100000);
+    const std::size_t chunk_size = 64 << 10;
+    const std::size_t iterations = 5;
+
+    bench::Report("buffer whole body, then UpdateWithJson", bench::Measure(iterations, [&] {
+                      std::string buffer;
+                      Receive(json, chunk_size, [&](const char *data, std::size_t length) {
+                          buffer.append(data, length);
+                      });
+                      Body body;
+                      bench::sink += bound::UpdateWithJson(body, buffer).success;
+                  }),
+                  "body");
+
+    bench::Report("IncrementalReader", bench::Measure(iterations, [&] {
+                      Body body;
+                      bound::IncrementalReader<Body> reader{body};
+                      Receive(json, chunk_size, [&](const char *data, std::size_t length) {
+                          reader.Feed(data, length);
+                      });
+                      bench::sink += reader.Finish().success;
+                  }),
+                  "body");
+}
+
+bench::Register incremental{"incremental", Run};
+
+} // namespace bench_incremental_bench_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,75 @@
+#ifndef BENCH_INSITU_BENCH_HPP_
+#define BENCH_INSITU_BENCH_HPP_
+
+#include <cstring>
+#include "bench.h"
+
+namespace bench_insitu_bench_hpp_
+{
+
+struct Record
+{
+    int id;
+    std::string name;
+    std::string description;
+    std::vector<std::string> tags;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Record::id, "id"),
+        bound::property(&Record::name, "name"),
+        bound::property(&Record::description, "description"),
+        bound::property(&Record::tags, "tags"));
+};
+
+// String heavy document, some strings with escapes to decode
+std::string Document(std::size_t count)
+{
+    std::string json = "[";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::string id = std::to_string(i);
+        json += (i > 0 ? "," : "");
+        json += "{\"id\":" + id +
+                ",\"name\":\"record " + id + "\"" +
+                ",\"description\":\"line one\\nline \\\"two\\\" of record " + id + "\"" +
+                ",\"tags\":[\"alpha\",\"beta\",\"gamma\"]}";
+    }
+    json += "]";
+    return json;
+}
+
+void Run()
+{
+    const std::size_t count = 1000;
+    const std::string json = Document(count);
+    std::vector<char> buffer(json.size());
+    const std::size_t iterations = 200;
+
+    std::vector<Record> records;
+
+    bench::Report("FromJson", bench::Measure(iterations, [&] {
+                      bench::sink += bound::UpdateWithJson(records, json).success;
+                  }) / count,
+                  "record");
+
+    // In situ parsing overwrites its input, so each run needs a fresh copy
+    bench::Report("memcpy only", bench::Measure(iterations, [&] {
+                      std::memcpy(buffer.data(), json.data(), json.size());
+                      bench::sink += buffer[0];
+                  }) / count,
+                  "record");
+
+    bench::Report("memcpy + FromJsonInsitu", bench::Measure(iterations, [&] {
+                      std::memcpy(buffer.data(), json.data(), json.size());
+                      bench::sink += bound::UpdateWithJsonInsitu(
+                                         records, buffer.data(), buffer.size())
+                                         .success;
+                  }) / count,
+                  "record");
+}
+
+bench::Register insitu{"insitu", Run};
+
+} // namespace bench_insitu_bench_hpp_
+
+#endif
\ No newline at end of file
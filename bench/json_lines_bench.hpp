@@ -0,0 +1,86 @@
+#ifndef BENCH_JSON_LINES_BENCH_HPP_
+#define BENCH_JSON_LINES_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_json_lines_bench_hpp_
+{
+
+struct LogRecord
+{
+    uint64_t timestamp;
+    std::string level;
+    std::string message;
+    std::map<std::string, std::string> labels;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&LogRecord::timestamp, "timestamp"),
+        bound::property(&LogRecord::level, "level"),
+        bound::property(&LogRecord::message, "message"),
+        bound::property(&LogRecord::labels, "labels"));
+};
+
+std::vector<LogRecord> Records(std::size_t count)
+{
+    std::vector<LogRecord> records(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        records[i].timestamp = 1575367200000 + i;
+        records[i].level = i % 10 == 0 ? "warn" : "info";
+        records[i].message = "request " + std::to_string(i) + " served";
+        records[i].labels = {{"host", "web-" + std::to_string(i % 8)}, {"path", "/api/items"}};
+    }
+    return records;
+}
+
+void Run()
+{
+    const std::size_t count = 10000;
+    std::vector<LogRecord> records = Records(count);
+    const std::string json = bound::ToJsonLines(records);
+    const std::size_t iterations = 20;
+
+    // Baseline: a parser and reader constructed per line
+    std::vector<std::string> lines;
+    for (std::size_t begin = 0, end; (end = json.find('\n', begin)) != std::string::npos; begin = end + 1)
+    {
+        lines.push_back(json.substr(begin, end - begin));
+    }
+
+    bench::ReportRate("CreateWithJson per line", bench::Measure(iterations, [&] {
+                          for (auto &line : lines)
+                          {
+                              bench::sink += bound::CreateWithJson<LogRecord>(line).success;
+                          }
+                      }) / count,
+                      "record");
+
+    bench::ReportRate("ReadJsonLines", bench::Measure(iterations, [&] {
+                          bench::sink += bound::ReadJsonLines<LogRecord>(json, [](LogRecord &record) {
+                                             bench::sink += record.timestamp;
+                                         }).success;
+                      }) / count,
+                      "record");
+
+    bench::ReportRate("ToJson per record", bench::Measure(iterations, [&] {
+                          std::string out;
+                          for (auto &record : records)
+                          {
+                              out += bound::ToJson(record);
+                              out += '\n';
+                          }
+                          bench::sink += out.size();
+                      }) / count,
+                      "record");
+
+    bench::ReportRate("ToJsonLines", bench::Measure(iterations, [&] {
+                          bench::sink += bound::ToJsonLines(records).size();
+                      }) / count,
+                      "record");
+}
+
+bench::Register json_lines{"json_lines", Run};
+
+} // namespace bench_json_lines_bench_hpp_
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef BENCH_JSON_POINTER_BENCH_HPP_
+#define BENCH_JSON_POINTER_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_json_pointer_bench_hpp_
+{
+
+struct Tenant
+{
+    int id;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Tenant::id, "id"));
+};
+
+struct Meta
+{
+    Tenant tenant;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Meta::tenant, "tenant"));
+};
+
+struct Envelope
+{
+    Meta meta;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Envelope::meta, "meta"));
+};
+
+std::string Items(std::size_t count)
+{
+    std::string json = "[";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        json += (i > 0 ? "," : "");
+        json += "{\"id\":" + std::to_string(i) + ",\"tags\":[\"a\",\"b\"]}";
+    }
+    return json + "]";
+}
+
+void Report(const char *label, const std::string &json)
+{
+    bench::ReportRate(std::string(label) + ", bound struct chain", bench::Measure(500, [&] {
+                          bench::sink += bound::CreateWithJson<Envelope>(json).instance.meta.tenant.id;
+                      }),
+                      "doc");
+
+    bench::ReportRate(std::string(label) + ", ReadAt", bench::Measure(500, [&] {
+                          bench::sink += bound::ReadAt<int>(json, "/meta/tenant/id").instance;
+                      }),
+                      "doc");
+}
+
+void Run()
+{
+    const std::string items = Items(10000);
+    const std::string meta = "\"meta\":{\"region\":\"eu\",\"tenant\":{\"name\":\"acme\",\"id\":7}}";
+
+    Report("target first", "{" + meta + ",\"items\":" + items + "}");
+    Report("target last", "{\"items\":" + items + "," + meta + "}");
+}
+
+bench::Register json_pointer{"json_pointer", Run};
+
+} // namespace bench_json_pointer_bench_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,84 @@
+#ifndef BENCH_LAZY_BENCH_HPP_
+#define BENCH_LAZY_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_lazy_bench_hpp_
+{
+
+struct Item
+{
+    int id;
+    std::string name;
+    std::vector<double> values;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Item::id, "id"),
+        bound::property(&Item::name, "name"),
+        bound::property(&Item::values, "values"));
+};
+
+struct Payload
+{
+    std::vector<Item> items;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Payload::items, "items"));
+};
+
+template <typename P>
+struct Message
+{
+    int id;
+    P payload;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Message::id, "id"),
+        bound::property(&Message::payload, "payload"));
+};
+
+// Small header followed by a large payload
+std::string Document(std::size_t count)
+{
+    std::string json = "{\"id\":1,\"payload\":{\"items\":[";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::string id = std::to_string(i);
+        json += (i > 0 ? "," : "");
+        json += "{\"id\":" + id + ",\"name\":\"item " + id + "\",\"values\":[0.5,1.5,2.5,3.5]}";
+    }
+    json += "]}}";
+    return json;
+}
+
+void Run()
+{
+    const std::size_t count = 1000;
+    const std::string json = Document(count);
+    const std::size_t iterations = 200;
+
+    Message<Payload> eager;
+    Message<bound::JsonLazy<Payload>> lazy;
+
+    bench::Report("eager payload", bench::Measure(iterations, [&] {
+                      bench::sink += bound::UpdateWithJson(eager, json).success;
+                  }),
+                  "message");
+
+    bench::Report("lazy payload, untouched", bench::Measure(iterations, [&] {
+                      bench::sink += bound::UpdateWithJson(lazy, json).success;
+                  }),
+                  "message");
+
+    bench::Report("lazy payload, accessed", bench::Measure(iterations, [&] {
+                      bound::UpdateWithJson(lazy, json);
+                      bench::sink += lazy.payload.Get().items.size();
+                  }),
+                  "message");
+}
+
+bench::Register lazy{"lazy", Run};
+
+} // namespace bench_lazy_bench_hpp_
+
+#endif
@@ -0,0 +1,40 @@
+#include "bench.h"
+#include "property_index_bench.hpp"
+#include "insitu_bench.hpp"
+#include "mapped_file_bench.hpp"
+#include "raw_json_bench.hpp"
+#include "skip_bench.hpp"
+#include "lazy_bench.hpp"
+#include "stream_array_bench.hpp"
+#include "json_lines_bench.hpp"
+#include "parallel_lines_bench.hpp"
+#include "parallel_array_bench.hpp"
+#include "arena_bench.hpp"
+#include "read_context_bench.hpp"
+#include "incremental_bench.hpp"
+#include "number_bench.hpp"
+#include "read_config_bench.hpp"
+#include "error_bench.hpp"
+#include "field_mask_bench.hpp"
+#include "json_pointer_bench.hpp"
+#include "stop_when_filled_bench.hpp"
+#include "property_presence_bench.hpp"
+#include "create_many_bench.hpp"
+
+int main(int argc, char **argv)
+{
+    const std::string filter = argc > 1 ? argv[1] : "";
+
+    for (auto &benchmark : bench::Benchmarks())
+    {
+        if (std::string(benchmark.name).find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        printf("%s\n", benchmark.name);
+        benchmark.run();
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#ifndef BENCH_MAPPED_FILE_BENCH_HPP_
+#define BENCH_MAPPED_FILE_BENCH_HPP_
+
+#include <cstdio>
+#include <cstdlib>
+#include "bench.h"
+
+namespace bench_mapped_file_bench_hpp_
+{
+
+struct Item
+{
+    int id;
+    std::string sku;
+    std::vector<double> prices;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Item::id, "id"),
+        bound::property(&Item::sku, "sku"),
+        bound::property(&Item::prices, "prices"));
+};
+
+struct Catalog
+{
+    std::vector<Item> items;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Catalog::items, "items"));
+};
+
+// Writes a catalog of about megabytes MB
+void WriteCatalog(const char *path, std::size_t megabytes)
+{
+    FILE *file = fopen(path, "w");
+    std::size_t size = 0;
+    size += fprintf(file, "{\"items\":[");
+    for (std::size_t i = 0; size < megabytes << 20; ++i)
+    {
+        size += fprintf(file, "%s{\"id\":%zu,\"sku\":\"SKU-%08zu\",\"prices\":[%zu.25,%zu.5]}",
+                        i > 0 ? "," : "", i, i, i % 1000, i % 100);
+    }
+    size += fprintf(file, "]}");
+    fclose(file);
+}
+
+template <typename F>
+void Startup(const char *label, std::size_t megabytes, F &&load)
+{
+    // Few runs; each one is a full startup load
+    const double ns = bench::Measure(3, [&] {
+        auto status = load();
+        bench::sink += status.success + status.instance.items.size();
+    });
+    bench::Report(label, ns / megabytes, "MB");
+}
+
+void Run()
+{
+    // BOUND_BENCH_FILE_MB overrides the size of the generated file
+    const char *env = getenv("BOUND_BENCH_FILE_MB");
+    const std::size_t megabytes = env ? strtoul(env, nullptr, 10) : 256;
+    const char *path = "mapped_file_bench.json";
+
+    WriteCatalog(path, megabytes);
+    printf("  %zu MB file, page cache warm\n", megabytes);
+
+    Startup("FileReadMode::kStream", megabytes, [&] {
+        return bound::CreateWithJsonFile<Catalog>(path, bound::FileReadMode::kStream);
+    });
+    Startup("FileReadMode::kMapped", megabytes, [&] {
+        return bound::CreateWithJsonFile<Catalog>(path, bound::FileReadMode::kMapped);
+    });
+    Startup("FileReadMode::kMappedHugePages", megabytes, [&] {
+        return bound::CreateWithJsonFile<Catalog>(path, bound::FileReadMode::kMappedHugePages);
+    });
+
+    remove(path);
+}
+
+bench::Register mapped_file{"mapped_file", Run};
+
+} // namespace bench_mapped_file_bench_hpp_
+
+#endif
\ No newline at end of file
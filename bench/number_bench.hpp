@@ -0,0 +1,50 @@
+#ifndef BENCH_NUMBER_BENCH_HPP_
+#define BENCH_NUMBER_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_number_bench_hpp_
+{
+
+std::string Numbers(std::size_t count, const char *format)
+{
+    std::string json = "[";
+    char buffer[32];
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        snprintf(buffer, sizeof(buffer), format, i % 100, i % 7);
+        json += (i > 0 ? "," : "");
+        json += buffer;
+    }
+    return json + "]";
+}
+
+template <typename T>
+void Report(const char *label, const std::string &json, std::size_t count)
+{
+    std::vector<T> values;
+    bench::Report(label, bench::Measure(50, [&] {
+                      bench::sink += bound::UpdateWithJson(values, json).success;
+                  }) / count,
+                  "number");
+}
+
+void Run()
+{
+    const std::size_t count = 100000;
+    const std::string integers = Numbers(count, "%zu");
+    const std::string decimals = Numbers(count, "%zu.%zu25");
+
+    Report<uint8_t>("uint8_t", integers, count);
+    Report<int>("int", integers, count);
+    Report<int64_t>("int64_t", integers, count);
+    Report<double>("double from integers", integers, count);
+    Report<float>("float", decimals, count);
+    Report<double>("double", decimals, count);
+}
+
+bench::Register number{"number", Run};
+
+} // namespace bench_number_bench_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,79 @@
+#ifndef BENCH_PARALLEL_ARRAY_BENCH_HPP_
+#define BENCH_PARALLEL_ARRAY_BENCH_HPP_
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include "bench.h"
+
+namespace bench_parallel_array_bench_hpp_
+{
+
+struct Event
+{
+    uint64_t id;
+    std::string source;
+    std::vector<double> samples;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Event::id, "id"),
+        bound::property(&Event::source, "source"),
+        bound::property(&Event::samples, "samples"));
+};
+
+// Writes a top-level array of about megabytes MB; returns the element count
+std::size_t WriteArray(const char *path, std::size_t megabytes)
+{
+    FILE *file = fopen(path, "w");
+    std::size_t size = fprintf(file, "[");
+    std::size_t i = 0;
+    for (; size < megabytes << 20; ++i)
+    {
+        size += fprintf(file, "%s{\"id\":%zu,\"source\":\"sensor-%04zu\",\"samples\":[%zu.5,%zu.25,%zu.125]}",
+                        i ? ",\n" : "", i, i % 10000, i % 1000, i % 100, i % 10);
+    }
+    fprintf(file, "]\n");
+    fclose(file);
+    return i;
+}
+
+void Run()
+{
+    // BOUND_BENCH_FILE_MB overrides the size of the generated file
+    const char *env = getenv("BOUND_BENCH_FILE_MB");
+    const std::size_t megabytes = env ? strtoul(env, nullptr, 10) : 256;
+    const char *path = "parallel_array_bench.json";
+
+    const std::size_t count = WriteArray(path, megabytes);
+    printf("  %zu MB file, %zu elements, page cache warm\n", megabytes, count);
+
+    bench::ReportRate("CreateWithJsonFile", bench::Measure(3, [&] {
+                          bench::sink += bound::CreateWithJsonFile<std::vector<Event>>(
+                                             path, bound::FileReadMode::kMapped)
+                                             .instance.size();
+                      }) / count,
+                      "element");
+
+    const unsigned hardware = std::max(std::thread::hardware_concurrency(), 1u);
+    for (unsigned threads = 1;; threads = std::min(threads * 2, hardware))
+    {
+        const double ns = bench::Measure(3, [&] {
+            bench::sink += bound::CreateWithJsonFileParallel<std::vector<Event>>(path, threads)
+                               .instance.size();
+        });
+        bench::ReportRate(std::to_string(threads) + " threads", ns / count, "element");
+
+        if (threads == hardware)
+        {
+            break;
+        }
+    }
+
+    remove(path);
+}
+
+bench::Register parallel_array{"parallel_array", Run};
+
+} // namespace bench_parallel_array_bench_hpp_
+
+#endif
\ No newline at end of file
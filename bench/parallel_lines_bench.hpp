@@ -0,0 +1,86 @@
+#ifndef BENCH_PARALLEL_LINES_BENCH_HPP_
+#define BENCH_PARALLEL_LINES_BENCH_HPP_
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include "bench.h"
+
+namespace bench_parallel_lines_bench_hpp_
+{
+
+struct Event
+{
+    uint64_t id;
+    std::string source;
+    std::vector<double> samples;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Event::id, "id"),
+        bound::property(&Event::source, "source"),
+        bound::property(&Event::samples, "samples"));
+};
+
+// Writes JSON Lines of about megabytes MB; returns the record count
+std::size_t WriteLines(const char *path, std::size_t megabytes)
+{
+    FILE *file = fopen(path, "w");
+    std::size_t size = 0;
+    std::size_t i = 0;
+    for (; size < megabytes << 20; ++i)
+    {
+        size += fprintf(file, "{\"id\":%zu,\"source\":\"sensor-%04zu\",\"samples\":[%zu.5,%zu.25,%zu.125]}\n",
+                        i, i % 10000, i % 1000, i % 100, i % 10);
+    }
+    fclose(file);
+    return i;
+}
+
+void Run()
+{
+    // BOUND_BENCH_FILE_MB overrides the size of the generated file
+    const char *env = getenv("BOUND_BENCH_FILE_MB");
+    const std::size_t megabytes = env ? strtoul(env, nullptr, 10) : 256;
+    const char *path = "parallel_lines_bench.json";
+
+    const std::size_t count = WriteLines(path, megabytes);
+    printf("  %zu MB file, %zu records, page cache warm\n", megabytes, count);
+
+    bench::ReportRate("ReadJsonLinesFile", bench::Measure(3, [&] {
+                          bench::sink += bound::ReadJsonLinesFile<Event>(
+                                             path, [](Event &event) { bench::sink += event.id; },
+                                             bound::FileReadMode::kMapped)
+                                             .success;
+                      }) / count,
+                      "record");
+
+    const unsigned hardware = std::max(std::thread::hardware_concurrency(), 1u);
+    for (unsigned threads = 1;; threads = std::min(threads * 2, hardware))
+    {
+        for (auto order : {bound::ParallelOrder::kInput, bound::ParallelOrder::kCompletion})
+        {
+            const double ns = bench::Measure(3, [&] {
+                bench::sink += bound::ReadJsonLinesFileParallel<Event>(
+                                   path, [](Event &event) { bench::sink += event.id; },
+                                   order, threads)
+                                   .success;
+            });
+            bench::ReportRate(std::to_string(threads) + " threads, " +
+                                  (order == bound::ParallelOrder::kInput ? "input order" : "completion order"),
+                              ns / count, "record");
+        }
+
+        if (threads == hardware)
+        {
+            break;
+        }
+    }
+
+    remove(path);
+}
+
+bench::Register parallel_lines{"parallel_lines", Run};
+
+} // namespace bench_parallel_lines_bench_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,108 @@
+#ifndef BENCH_PROPERTY_INDEX_BENCH_HPP_
+#define BENCH_PROPERTY_INDEX_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_property_index_bench_hpp_
+{
+
+// Key "field_000" through "field_999"; a shared prefix is typical of payloads
+template <std::size_t I>
+struct FieldName
+{
+    constexpr static char value[] = {
+        'f', 'i', 'e', 'l', 'd', '_',
+        static_cast<char>('0' + I / 100 % 10),
+        static_cast<char>('0' + I / 10 % 10),
+        static_cast<char>('0' + I % 10),
+        '\0'};
+};
+
+template <std::size_t I>
+constexpr char FieldName<I>::value[];
+
+template <std::size_t I>
+struct Field
+{
+    int value;
+};
+
+template <typename Sequence>
+struct Wide;
+
+// Bound object with one int property per index
+template <std::size_t... I>
+struct Wide<std::index_sequence<I...>> : Field<I>...
+{
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Field<I>::value, FieldName<I>::value)...);
+};
+
+template <std::size_t N>
+using WideObject = Wide<std::make_index_sequence<N>>;
+
+// Property lookup prior to the compile-time index
+template <typename T>
+bool LinearFind(T &instance, const std::string &key)
+{
+    bool found = false;
+    bound::ListProperties(instance, [&](auto &property) {
+        if (property.name == key)
+        {
+            found = true;
+        }
+    });
+    return found;
+}
+
+template <std::size_t N>
+void RunDispatch()
+{
+    using T = WideObject<N>;
+    T instance;
+
+    std::vector<std::string> keys;
+    std::string json = "{";
+    bound::ListProperties(instance, [&](auto &property) {
+        keys.push_back(property.name);
+        json += (keys.size() > 1 ? ",\"" : "\"") + keys.back() + "\":1";
+    });
+    json += "}";
+
+    const std::string label = std::to_string(N) + " properties";
+    const std::size_t iterations = 2000000 / N;
+
+    bench::Report(label + ", linear scan", bench::Measure(iterations, [&] {
+               for (auto &key : keys)
+               {
+                   bench::sink += LinearFind(instance, key);
+               }
+           }) / N,
+           "key");
+
+    bench::Report(label + ", PropertyIndex::Find", bench::Measure(iterations, [&] {
+               for (auto &key : keys)
+               {
+                   bench::sink += bound::read::PropertyIndex<T>::Find(key.c_str(), key.length());
+               }
+           }) / N,
+           "key");
+
+    bench::Report(label + ", UpdateWithJson", bench::Measure(iterations / 4, [&] {
+               bench::sink += bound::UpdateWithJson(instance, json).success;
+           }) / N,
+           "key");
+}
+
+void Run()
+{
+    RunDispatch<8>();
+    RunDispatch<32>();
+    RunDispatch<128>();
+}
+
+bench::Register property_index{"property_index", Run};
+
+} // namespace bench_property_index_bench_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef BENCH_PROPERTY_PRESENCE_BENCH_HPP_
+#define BENCH_PROPERTY_PRESENCE_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_property_presence_bench_hpp_
+{
+
+struct Loose
+{
+    int id;
+    std::string name;
+    double score;
+    bool active;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Loose::id, "id"),
+        bound::property(&Loose::name, "name"),
+        bound::property(&Loose::score, "score"),
+        bound::property(&Loose::active, "active"));
+};
+
+struct Strict
+{
+    int id;
+    std::string name;
+    double score;
+    bool active;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Strict::id, "id").Required(),
+        bound::property(&Strict::name, "name").Required(),
+        bound::property(&Strict::score, "score"),
+        bound::property(&Strict::active, "active"));
+};
+
+std::string Json(std::size_t count)
+{
+    std::string json = "[";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        json += (i > 0 ? "," : "");
+        json += "{\"id\":" + std::to_string(i) + ",\"name\":\"n\",\"score\":1.5,\"active\":true}";
+    }
+    return json + "]";
+}
+
+void Run()
+{
+    const std::string json = Json(20000);
+    std::vector<Loose> loose;
+    std::vector<Strict> strict;
+
+    bench::ReportRate("untracked", bench::Measure(100, [&] {
+                          bench::sink += bound::UpdateWithJson(loose, json).success;
+                      }),
+                      "doc");
+
+    bench::ReportRate("required", bench::Measure(100, [&] {
+                          bench::sink += bound::UpdateWithJson(strict, json).success;
+                      }),
+                      "doc");
+
+    bench::ReportRate("required, reject duplicates", bench::Measure(100, [&] {
+                          bench::sink += bound::UpdateWithJson(
+                                             strict, json,
+                                             bound::ReadConfig<bound::kReadComments | bound::kReadRejectDuplicateKeys>())
+                                             .success;
+                      }),
+                      "doc");
+}
+
+bench::Register property_presence{"property_presence", Run};
+
+} // namespace bench_property_presence_bench_hpp_
+
+#endif
\ No newline at end of file
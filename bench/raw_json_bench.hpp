@@ -0,0 +1,62 @@
+#ifndef BENCH_RAW_JSON_BENCH_HPP_
+#define BENCH_RAW_JSON_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_raw_json_bench_hpp_
+{
+
+// String stream without source capture, so JsonRaw is rewritten from events
+struct RewriteStream : rapidjson::StringStream
+{
+    RewriteStream(const char *json) : rapidjson::StringStream(json) {}
+};
+
+// Map of opaque sub-documents
+std::string Document(std::size_t count)
+{
+    std::string json = "{";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::string id = std::to_string(i);
+        json += (i > 0 ? ",\"" : "\"") + id + "\":" +
+                "{\"name\":\"document " + id + "\",\"ratio\":0.1234567890123," +
+                "\"values\":[1,2,3,4,5,6,7,8],\"nested\":{\"flag\":true,\"note\":null}}";
+    }
+    json += "}";
+    return json;
+}
+
+template <typename Stream>
+bool Read(const std::string &json, std::map<std::string, bound::JsonRaw> &raw)
+{
+    bound::read::ReadStatus status;
+    bound::read::Parser<Stream> parser{Stream(json.c_str())};
+    bound::read::Reader<Stream>{parser, status}.ReadDocument(raw);
+    return status.success();
+}
+
+void Run()
+{
+    const std::size_t count = 1000;
+    const std::string json = Document(count);
+    const std::size_t iterations = 200;
+
+    std::map<std::string, bound::JsonRaw> raw;
+
+    bench::Report("rewrite events", bench::Measure(iterations, [&] {
+                      bench::sink += Read<RewriteStream>(json, raw);
+                  }) / count,
+                  "value");
+
+    bench::Report("capture source bytes", bench::Measure(iterations, [&] {
+                      bench::sink += Read<rapidjson::StringStream>(json, raw);
+                  }) / count,
+                  "value");
+}
+
+bench::Register raw_json{"raw_json", Run};
+
+} // namespace bench_raw_json_bench_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef BENCH_READ_CONFIG_BENCH_HPP_
+#define BENCH_READ_CONFIG_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_read_config_bench_hpp_
+{
+
+std::string Decimals(std::size_t count)
+{
+    std::string json = "[";
+    char buffer[32];
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        snprintf(buffer, sizeof(buffer), "%zu.%zu7531", i % 1000, i % 9);
+        json += (i > 0 ? "," : "");
+        json += buffer;
+    }
+    return json + "]";
+}
+
+template <unsigned Flags>
+void Report(const char *label, const std::string &json, std::size_t count)
+{
+    std::vector<double> values;
+    bench::Report(label, bench::Measure(50, [&] {
+                      bench::sink += bound::UpdateWithJson(values, json, bound::ReadConfig<Flags>()).success;
+                  }) / count,
+                  "number");
+}
+
+void Run()
+{
+    const std::size_t count = 100000;
+    const std::string json = Decimals(count);
+
+    Report<bound::kReadComments>("default", json, count);
+    Report<0>("no flags", json, count);
+    Report<bound::kReadStopWhenDone>("stop when done", json, count);
+    Report<bound::kReadFullPrecision>("full precision", json, count);
+    Report<bound::kReadValidateEncoding>("validate encoding", json, count);
+}
+
+bench::Register read_config{"read_config", Run};
+
+} // namespace bench_read_config_bench_hpp_
+
+#endif
\ No newline at end of file
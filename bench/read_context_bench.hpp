@@ -0,0 +1,57 @@
+#ifndef BENCH_READ_CONTEXT_BENCH_HPP_
+#define BENCH_READ_CONTEXT_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_read_context_bench_hpp_
+{
+
+struct Message
+{
+    int id;
+    std::string type;
+    std::map<std::string, std::string> headers;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Message::id, "id"),
+        bound::property(&Message::type, "type"),
+        bound::property(&Message::headers, "headers"));
+};
+
+const char *kJson =
+    "{\"id\":42,\"type\":\"order.created\","
+    "\"headers\":{\"trace\":\"4bf92f3577b34da6\",\"tenant\":\"acme\"}}";
+
+void Run()
+{
+    const std::size_t iterations = 200000;
+    Message message;
+
+    // A parser constructed for every message, as before contexts were kept
+    bench::ReportRate("fresh parser", bench::Measure(iterations, [&] {
+                          bound::read::ReadStatus status;
+                          bound::read::Parser<rapidjson::StringStream> parser{rapidjson::StringStream(kJson)};
+                          bound::read::Reader<rapidjson::StringStream>{parser, status}.ReadDocument(message);
+                          bench::sink += message.id;
+                      }),
+                      "message");
+
+    bench::ReportRate("implicit thread local context", bench::Measure(iterations, [&] {
+                          bound::UpdateWithJson(message, kJson);
+                          bench::sink += message.id;
+                      }),
+                      "message");
+
+    bound::ReadContext context;
+    bench::ReportRate("explicit context", bench::Measure(iterations, [&] {
+                          bound::UpdateWithJson(context, message, kJson);
+                          bench::sink += message.id;
+                      }),
+                      "message");
+}
+
+bench::Register read_context{"read_context", Run};
+
+} // namespace bench_read_context_bench_hpp_
+
+#endif
\ No newline at end of file
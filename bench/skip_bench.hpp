@@ -0,0 +1,78 @@
+#ifndef BENCH_SKIP_BENCH_HPP_
+#define BENCH_SKIP_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_skip_bench_hpp_
+{
+
+// String stream without raw access, so skipped values are tokenized
+struct TokenizeStream : rapidjson::StringStream
+{
+    TokenizeStream(const char *json) : rapidjson::StringStream(json) {}
+};
+
+struct Record
+{
+    int id;
+    std::string name;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Record::id, "id"),
+        bound::property(&Record::name, "name"));
+};
+
+// Records where most of each object is unbound
+std::string Document(std::size_t count)
+{
+    std::string json = "[";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::string id = std::to_string(i);
+        json += (i > 0 ? "," : "");
+        json += "{\"id\":" + id +
+                ",\"audit\":{\"created\":\"2019-12-03T10:00:00Z\",\"by\":\"user " + id + "\"" +
+                ",\"history\":[{\"at\":1575367200,\"note\":\"created \\\"draft\\\"\"}," +
+                "{\"at\":1575370800,\"note\":\"published\"}]}" +
+                ",\"metrics\":[0.125,0.25,0.5,1.0,2.0,4.0,8.0,16.0,32.0,64.0]" +
+                ",\"description\":\"an unbound description of record " + id +
+                " that is long enough to be worth scanning a vector at a time\"" +
+                ",\"name\":\"record " + id + "\"}";
+    }
+    json += "]";
+    return json;
+}
+
+template <typename Stream>
+bool Read(const std::string &json, std::vector<Record> &records)
+{
+    bound::read::ReadStatus status;
+    bound::read::Parser<Stream> parser{Stream(json.c_str())};
+    bound::read::Reader<Stream>{parser, status}.ReadDocument(records);
+    return status.success();
+}
+
+void Run()
+{
+    const std::size_t count = 1000;
+    const std::string json = Document(count);
+    const std::size_t iterations = 200;
+
+    std::vector<Record> records;
+
+    bench::Report("tokenize skipped values", bench::Measure(iterations, [&] {
+                      bench::sink += Read<TokenizeStream>(json, records);
+                  }) / count,
+                  "record");
+
+    bench::Report("scan skipped values", bench::Measure(iterations, [&] {
+                      bench::sink += Read<rapidjson::StringStream>(json, records);
+                  }) / count,
+                  "record");
+}
+
+bench::Register skip{"skip", Run};
+
+} // namespace bench_skip_bench_hpp_
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef BENCH_STOP_WHEN_FILLED_BENCH_HPP_
+#define BENCH_STOP_WHEN_FILLED_BENCH_HPP_
+
+#include "bench.h"
+
+namespace bench_stop_when_filled_bench_hpp_
+{
+
+struct Header
+{
+    int id;
+    std::string kind;
+    std::string source;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Header::id, "id"),
+        bound::property(&Header::kind, "kind"),
+        bound::property(&Header::source, "source"));
+};
+
+std::string Json(std::size_t count)
+{
+    std::string json = "{\"id\":7,\"kind\":\"batch\",\"source\":\"upstream\",\"rows\":[";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        json += (i > 0 ? "," : "");
+        json += "[" + std::to_string(i) + ",1.5,\"r\"]";
+    }
+    return json + "]}";
+}
+
+void Run()
+{
+    const std::string json = Json(20000);
+    Header header;
+
+    bench::ReportRate("read to the end", bench::Measure(200, [&] {
+                          bench::sink += bound::UpdateWithJson(header, json).success;
+                      }),
+                      "doc");
+
+    bench::ReportRate("stop when filled", bench::Measure(200, [&] {
+                          bench::sink += bound::UpdateWithJson(
+                                             header, json,
+                                             bound::ReadConfig<bound::kReadComments | bound::kReadStopWhenFilled>())
+                                             .offset;
+                      }),
+                      "doc");
+}
+
+bench::Register stop_when_filled{"stop_when_filled", Run};
+
+} // namespace bench_stop_when_filled_bench_hpp_
+
+#endif
\ No newline at end of file
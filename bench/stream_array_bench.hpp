@@ -0,0 +1,87 @@
+#ifndef BENCH_STREAM_ARRAY_BENCH_HPP_
+#define BENCH_STREAM_ARRAY_BENCH_HPP_
+
+#include <cstdio>
+#include <cstdlib>
+#include <sys/resource.h>
+#include "bench.h"
+
+namespace bench_stream_array_bench_hpp_
+{
+
+struct Event
+{
+    uint64_t id;
+    std::string source;
+    std::vector<double> samples;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Event::id, "id"),
+        bound::property(&Event::source, "source"),
+        bound::property(&Event::samples, "samples"));
+};
+
+// Writes a top-level array of about megabytes MB
+void WriteEvents(const char *path, std::size_t megabytes)
+{
+    FILE *file = fopen(path, "w");
+    std::size_t size = 0;
+    size += fprintf(file, "[");
+    for (std::size_t i = 0; size < megabytes << 20; ++i)
+    {
+        size += fprintf(file, "%s{\"id\":%zu,\"source\":\"sensor-%04zu\",\"samples\":[%zu.5,%zu.25,%zu.125]}",
+                        i > 0 ? ",\n" : "", i, i % 10000, i % 1000, i % 100, i % 10);
+    }
+    size += fprintf(file, "]");
+    fclose(file);
+}
+
+// Peak resident set size so far, in MB
+double PeakMB()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+}
+
+void Run()
+{
+    // BOUND_BENCH_FILE_MB overrides the size of the generated file; use a few
+    //  thousand for a multi-GB array
+    const char *env = getenv("BOUND_BENCH_FILE_MB");
+    const std::size_t megabytes = env ? strtoul(env, nullptr, 10) : 256;
+    const char *path = "stream_array_bench.json";
+
+    WriteEvents(path, megabytes);
+    printf("  %zu MB file, page cache warm\n", megabytes);
+
+    // Streamed first, as peak memory only grows
+    for (auto mode : {bound::FileReadMode::kStream, bound::FileReadMode::kMapped})
+    {
+        const double ns = bench::Measure(1, [&] {
+            bench::sink += bound::ForEachInJsonArrayFile<Event>(
+                               path, [](const Event &event) { bench::sink += event.id; }, mode)
+                               .success;
+        });
+        bench::Report(mode == bound::FileReadMode::kStream
+                          ? "ForEachInJsonArrayFile kStream"
+                          : "ForEachInJsonArrayFile kMapped",
+                      ns / megabytes, "MB");
+        printf("  peak RSS %.1f MB\n", PeakMB());
+    }
+
+    const double ns = bench::Measure(1, [&] {
+        auto status = bound::CreateWithJsonFile<std::vector<Event>>(path);
+        bench::sink += status.success + status.instance.size();
+    });
+    bench::Report("CreateWithJsonFile<std::vector<T>>", ns / megabytes, "MB");
+    printf("  peak RSS %.1f MB\n", PeakMB());
+
+    remove(path);
+}
+
+bench::Register stream_array{"stream_array", Run};
+
+} // namespace bench_stream_array_bench_hpp_
+
+#endif
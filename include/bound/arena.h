@@ -0,0 +1,274 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_ARENA_H_
+#define BOUND_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifndef BOUND_ARENA_BLOCK_SIZE
+#define BOUND_ARENA_BLOCK_SIZE (1 << 16)
+#endif
+
+namespace bound
+{
+
+// Monotonic region: allocations bump a cursor through blocks that are only
+//  freed all together. Objects allocated from it must be destroyed before it
+//  is reset or destroyed.
+class Arena
+{
+private:
+    struct Block
+    {
+        Block *next;
+        std::size_t size;
+    };
+
+    // Blocks double up to this size; larger requests get blocks of their own
+    constexpr static std::size_t kMaxBlockSize = 1 << 24;
+
+    Block *head_ = nullptr;
+    char *cursor_ = nullptr;
+    char *end_ = nullptr;
+    std::size_t block_size_;
+
+    static char *Data(Block *block)
+    {
+        return reinterpret_cast<char *>(block + 1);
+    }
+
+    void Grow(std::size_t size)
+    {
+        const std::size_t needed = sizeof(Block) + size;
+        const std::size_t block_size = block_size_ < needed ? needed : block_size_;
+        Block *block = static_cast<Block *>(std::malloc(block_size));
+
+        if (block == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        block->next = head_;
+        block->size = block_size;
+        head_ = block;
+        cursor_ = Data(block);
+        end_ = reinterpret_cast<char *>(block) + block_size;
+
+        if (block_size_ < kMaxBlockSize)
+        {
+            block_size_ *= 2;
+        }
+    }
+
+    static void Free(Block *block)
+    {
+        while (block != nullptr)
+        {
+            Block *next = block->next;
+            std::free(block);
+            block = next;
+        }
+    }
+
+    static Arena *&CurrentSlot()
+    {
+        static thread_local Arena *current = nullptr;
+        return current;
+    }
+
+    friend class ArenaScope;
+
+public:
+    explicit Arena(std::size_t block_size = BOUND_ARENA_BLOCK_SIZE)
+        : block_size_{block_size < sizeof(Block) * 2 ? sizeof(Block) * 2 : block_size} {}
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+    Arena(const Arena &&) = delete;
+    Arena &operator=(const Arena &&) = delete;
+
+    ~Arena()
+    {
+        Free(head_);
+    }
+
+    void *Allocate(std::size_t size, std::size_t alignment)
+    {
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(cursor_);
+        std::size_t padding = (alignment - address % alignment) % alignment;
+
+        if (cursor_ == nullptr || static_cast<std::size_t>(end_ - cursor_) < size + padding)
+        {
+            Grow(size + alignment);
+            address = reinterpret_cast<std::uintptr_t>(cursor_);
+            padding = (alignment - address % alignment) % alignment;
+        }
+
+        char *allocation = cursor_ + padding;
+        cursor_ = allocation + size;
+        return allocation;
+    }
+
+    // Drops every allocation at once, keeping the newest and largest block
+    //  for the next request
+    void Reset()
+    {
+        if (head_ == nullptr)
+        {
+            return;
+        }
+
+        Free(head_->next);
+        head_->next = nullptr;
+        cursor_ = Data(head_);
+    }
+
+    // Bytes held in blocks, used or not
+    std::size_t capacity() const
+    {
+        std::size_t capacity = 0;
+        for (Block *block = head_; block != nullptr; block = block->next)
+        {
+            capacity += block->size - sizeof(Block);
+        }
+        return capacity;
+    }
+
+    // The arena of the innermost ArenaScope on this thread, if any
+    static Arena *Current()
+    {
+        return CurrentSlot();
+    }
+};
+
+// Makes arena the one default constructed ArenaAllocators use on this thread
+//  until the scope ends, so every container of an object graph created by
+//  the reader draws from it
+class ArenaScope
+{
+private:
+    Arena *previous_;
+
+public:
+    explicit ArenaScope(Arena &arena)
+        : previous_{Arena::CurrentSlot()}
+    {
+        Arena::CurrentSlot() = &arena;
+    }
+    ArenaScope(const ArenaScope &) = delete;
+    ArenaScope &operator=(const ArenaScope &) = delete;
+    ArenaScope(const ArenaScope &&) = delete;
+    ArenaScope &operator=(const ArenaScope &&) = delete;
+
+    ~ArenaScope()
+    {
+        Arena::CurrentSlot() = previous_;
+    }
+};
+
+// Allocates from an arena, whose deallocation is a no-op, or from the global
+//  heap when created outside of any ArenaScope
+template <typename T>
+class ArenaAllocator
+{
+private:
+    Arena *arena_;
+
+    template <typename U>
+    friend class ArenaAllocator;
+
+public:
+    typedef T value_type;
+
+    ArenaAllocator() noexcept
+        : arena_{Arena::Current()} {}
+
+    explicit ArenaAllocator(Arena &arena) noexcept
+        : arena_{&arena} {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept
+        : arena_{other.arena_} {}
+
+    T *allocate(std::size_t count)
+    {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            throw std::bad_alloc();
+        }
+
+        if (arena_ == nullptr)
+        {
+            return static_cast<T *>(::operator new(count * sizeof(T)));
+        }
+
+        return static_cast<T *>(arena_->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *pointer, std::size_t count) noexcept
+    {
+        if (arena_ == nullptr)
+        {
+            ::operator delete(pointer);
+        }
+    }
+
+    Arena *arena() const
+    {
+        return arena_;
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const
+    {
+        return arena_ == other.arena_;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const
+    {
+        return arena_ != other.arena_;
+    }
+};
+
+typedef std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>> ArenaString;
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+template <typename V>
+using ArenaMap = std::map<
+    ArenaString,
+    V,
+    std::less<ArenaString>,
+    ArenaAllocator<std::pair<const ArenaString, V>>>;
+
+} // namespace bound
+
+#endif
\ No newline at end of file
@@ -22,107 +22,455 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef BOUND_BOUND_H_
 #define BOUND_BOUND_H_
 
-#define BOUND_MAJOR_VERSION 2
+#define BOUND_MAJOR_VERSION 3
 #define BOUND_MINOR_VERSION 0
 #define BOUND_PATCH_VERSION 0
-#define BOUND_VERSION_STRING "2.0.0"
+#define BOUND_VERSION_STRING "3.0.0"
 
 #ifndef BOUND_PROPS_NAME
 #define BOUND_PROPS_NAME properties
 #endif
 
+#include <cstring>
 #include <string>
+#include <vector>
 
+#include "arena.h"
 #include "write/writer.h"
 #include "read/reader.h"
+#include "read/parallel_reader.h"
+#include "read/incremental_reader.h"
 
 namespace bound
 {
 
+// Statuses carry the read's error code and offset, with error_message()
+//  formatting them and position() finding the line and column on request
 template <typename T>
-struct CreateStatus
+struct CreateStatus : read::ReadStatusBase
 {
     T instance;
-    const bool success;
-    const std::string error_message;
+    bool success;
 };
 
-struct UpdateStatus
+struct UpdateStatus : read::ReadStatusBase
 {
-    const bool success;
-    const std::string error_message;
+    bool success;
 };
 
-template <typename T>
-CreateStatus<T> CreateWithJson(const std::string &json)
+// Reads into the status' own instance so it is never copied; the status is
+//  returned by named return value
+template <typename T, typename From>
+CreateStatus<T> CreateWith(From &&from)
 {
-    T instance;
-    read::ReadStatus status = read::FromJson(json, instance);
-    return CreateStatus<T>{instance, status.success(), status.error_message};
+    CreateStatus<T> status{};
+    read::ReadStatus read_status = from(status.instance);
+    status.success = read_status.success();
+    static_cast<read::ReadStatusBase &>(status) = std::move(read_status);
+    return status;
+}
+
+inline UpdateStatus UpdateWith(read::ReadStatus &&read_status)
+{
+    UpdateStatus status{};
+    status.success = read_status.success();
+    static_cast<read::ReadStatusBase &>(status) = std::move(read_status);
+    return status;
+}
+
+// Updates instance with a document fed in chunks as they are received, each
+//  chunk parsed by the Feed handing it over. instance must not be used until
+//  Finish returns.
+template <typename T, typename Config = ReadConfig<>>
+class IncrementalReader
+{
+private:
+    read::IncrementalReader<T, Config> reader_;
+
+public:
+    explicit IncrementalReader(T &instance, const Config &config = Config())
+        : reader_{instance, config} {}
+
+    // Returns false once the document has failed to read
+    bool Feed(const char *data, std::size_t length)
+    {
+        return reader_.Feed(data, length);
+    }
+
+    bool Feed(const std::string &chunk)
+    {
+        return reader_.Feed(chunk);
+    }
+
+    UpdateStatus Finish()
+    {
+        return UpdateWith(reader_.Finish());
+    }
+};
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+CreateStatus<T> CreateWithJson(const char *json,
+                               const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return CreateWith<T>([&](T &instance) {
+        return read::FromJson(json, instance, config);
+    });
+}
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+CreateStatus<T> CreateWithJson(const std::string &json,
+                               const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return CreateWith<T>([&](T &instance) {
+        return read::FromJson(json, instance, config);
+    });
+}
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+inline CreateStatus<T> CreateWithJson(const std::string &&json,
+                                      const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return CreateWithJson<T>(json, config);
+}
+
+// Reads with the context's buffers instead of the thread's implicit ones
+template <typename T, typename Config>
+CreateStatus<T> CreateWithJson(BasicReadContext<Config> &context, const char *json)
+{
+    return CreateWith<T>([&](T &instance) {
+        return read::FromJson(context, json, instance);
+    });
+}
+
+template <typename T, typename Config>
+CreateStatus<T> CreateWithJson(BasicReadContext<Config> &context, const std::string &json)
+{
+    return CreateWith<T>([&](T &instance) {
+        return read::FromJson(context, json, instance);
+    });
+}
+
+// Outcome of CreateManyWithJson: each document's error code, kNone when it
+//  was read, and the offset reading stopped at, in input order. The status
+//  itself is the first failure's, its message naming the document.
+struct CreateManyStatus : read::ReadStatusBase
+{
+    std::vector<ReadError> errors;
+    std::vector<std::size_t> offsets;
+    bool success;
+};
+
+// Creates an instance from each of many small documents, as std::string or
+//  const char *, reusing the context's parser and one reader for all of them
+//  instead of setting them up per document. instances is resized to match.
+template <typename T, typename Document, typename Config>
+CreateManyStatus CreateManyWithJson(BasicReadContext<Config> &context,
+                                    const std::vector<Document> &documents,
+                                    std::vector<T> &instances)
+{
+    CreateManyStatus status{};
+    read::ReadStatus read_status =
+        read::FromJsonMany(context, documents, instances, status.errors, status.offsets);
+    status.success = read_status.success();
+    static_cast<read::ReadStatusBase &>(status) = std::move(read_status);
+    return status;
+}
+
+template <typename T, typename Document, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+CreateManyStatus CreateManyWithJson(const std::vector<Document> &documents,
+                                    std::vector<T> &instances,
+                                    const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return CreateManyWithJson(
+        BasicReadContext<ReadConfig<Flags, MaxDepth>>::ThreadLocal(), documents, instances);
+}
+
+// Creates T from the value at pointer, a JSON Pointer such as "/meta/id".
+//  Values before it are skipped and parsing stops at its end.
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+CreateStatus<T> ReadAt(const char *json, const char *pointer,
+                       const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return CreateWith<T>([&](T &instance) {
+        return read::FromJsonAt(json, pointer, std::strlen(pointer), instance, config);
+    });
+}
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+CreateStatus<T> ReadAt(const std::string &json, const char *pointer,
+                       const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return ReadAt<T>(json.c_str(), pointer, config);
+}
+
+// Parses json in place: its buffer is overwritten as strings are decoded.
+//  The buffer need not be null terminated.
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+CreateStatus<T> CreateWithJsonInsitu(char *json, std::size_t length,
+                                     const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return CreateWith<T>([&](T &instance) {
+        return read::FromJsonInsitu(json, length, instance, config);
+    });
+}
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+CreateStatus<T> CreateWithJsonFile(const std::string &path,
+                                   FileReadMode mode = FileReadMode::kStream,
+                                   const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return CreateWith<T>([&](T &instance) {
+        return read::FromJsonFile(path, instance, mode, config);
+    });
+}
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+inline CreateStatus<T> CreateWithJsonFile(const std::string &&path,
+                                          FileReadMode mode = FileReadMode::kStream,
+                                          const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return CreateWithJsonFile<T>(path, mode, config);
+}
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+UpdateStatus UpdateWithJson(T &instance, const char *json,
+                            const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return UpdateWith(read::FromJson(json, instance, config));
+}
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+UpdateStatus UpdateWithJson(T &instance, const std::string &json,
+                            const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return UpdateWith(read::FromJson(json, instance, config));
+}
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+inline UpdateStatus UpdateWithJson(T &instance, const std::string &&json,
+                                   const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return UpdateWithJson(instance, json, config);
+}
+
+// Reads only the properties selected by fields; the rest keep their values
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+UpdateStatus UpdateWithJson(T &instance, const char *json, const FieldMask<T> &fields,
+                            const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return UpdateWith(read::FromJson(json, instance, fields, config));
+}
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+UpdateStatus UpdateWithJson(T &instance, const std::string &json, const FieldMask<T> &fields,
+                            const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return UpdateWith(read::FromJson(json, instance, fields, config));
+}
+
+template <typename T, typename Config>
+UpdateStatus UpdateWithJson(BasicReadContext<Config> &context, T &instance, const char *json)
+{
+    return UpdateWith(read::FromJson(context, json, instance));
+}
+
+template <typename T, typename Config>
+UpdateStatus UpdateWithJson(BasicReadContext<Config> &context, T &instance, const std::string &json)
+{
+    return UpdateWith(read::FromJson(context, json, instance));
+}
+
+// Parses json in place: its buffer is overwritten as strings are decoded.
+//  The buffer need not be null terminated.
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+UpdateStatus UpdateWithJsonInsitu(T &instance, char *json, std::size_t length,
+                                  const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return UpdateWith(read::FromJsonInsitu(json, length, instance, config));
+}
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+UpdateStatus UpdateWithJsonFile(T &instance, const std::string &path,
+                                FileReadMode mode = FileReadMode::kStream,
+                                const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return UpdateWith(read::FromJsonFile(path, instance, mode, config));
+}
+
+template <typename T, unsigned Flags = ReadConfig<>::kParseFlags,
+          std::size_t MaxDepth = ReadConfig<>::kMaxDepth>
+inline UpdateStatus UpdateWithJsonFile(T &instance, const std::string &&path,
+                                       FileReadMode mode = FileReadMode::kStream,
+                                       const ReadConfig<Flags, MaxDepth> &config = ReadConfig<Flags, MaxDepth>())
+{
+    return UpdateWithJsonFile(instance, path, mode, config);
+}
+
+// Reads a top-level array one element at a time. Each element is read over
+//  the same T, so memory stays flat however long the array is; properties an
+//  element lacks keep the previous element's value.
+template <typename T, typename F>
+UpdateStatus ForEachInJsonArray(const char *json, F &&callback)
+{
+    T instance{};
+    return UpdateWith(read::ForEachInJson(json, instance, callback));
+}
+
+template <typename T, typename F>
+UpdateStatus ForEachInJsonArray(const std::string &json, F &&callback)
+{
+    return ForEachInJsonArray<T>(json.c_str(), callback);
+}
+
+template <typename T, typename F>
+UpdateStatus ForEachInJsonArrayFile(const std::string &path, F &&callback,
+                                    FileReadMode mode = FileReadMode::kStream)
+{
+    T instance{};
+    return UpdateWith(read::ForEachInJsonFile(path, instance, callback, mode));
+}
+
+// Reads whitespace separated documents, as JSON Lines, one at a time into
+//  a single T, as ForEachInJsonArray. Errors name the failing record.
+template <typename T, typename F>
+UpdateStatus ReadJsonLines(const char *json, F &&callback)
+{
+    T instance{};
+    return UpdateWith(read::ForEachJsonLine(json, instance, callback));
+}
+
+template <typename T, typename F>
+UpdateStatus ReadJsonLines(const std::string &json, F &&callback)
+{
+    return ReadJsonLines<T>(json.c_str(), callback);
+}
+
+template <typename T, typename F>
+UpdateStatus ReadJsonLinesFile(const std::string &path, F &&callback,
+                               FileReadMode mode = FileReadMode::kStream)
+{
+    T instance{};
+    return UpdateWith(read::ForEachJsonLineFile(path, instance, callback, mode));
 }
 
 template <typename T>
-inline CreateStatus<T> CreateWithJson(const std::string &&json)
+inline const std::string ToJson(T &instance, const WriteConfig &config)
 {
-    return CreateWithJson<T>(json);
+    return write::ToJson(instance, config);
 }
 
 template <typename T>
-CreateStatus<T> CreateWithJsonFile(const std::string &path)
+inline const std::string ToJson(T &instance, const WriteConfig &&config)
 {
-    T instance;
-    read::ReadStatus status = read::FromJsonFile(path, instance);
-    return CreateStatus<T>{instance, status.success(), status.error_message};
+    return ToJson(instance, config);
 }
 
 template <typename T>
-inline CreateStatus<T> CreateWithJsonFile(const std::string &&path)
+inline const std::string ToJson(T &instance)
+{
+    return ToJson(instance, WriteConfig());
+}
+
+// Parses JSON Lines in chunks across threads, hardware concurrency when 0.
+//  The callback, never called concurrently, gets each record in input order
+//  or as chunks complete. Reading stops at the first error in input order;
+//  in completion order records past it may already have been delivered.
+template <typename T, typename F>
+UpdateStatus ReadJsonLinesParallel(const char *json, std::size_t length, F &&callback,
+                                   ParallelOrder order = ParallelOrder::kInput,
+                                   unsigned threads = 0)
 {
-    return CreateWithJsonFile<T>(path);
+    return UpdateWith(read::ForEachJsonLineParallel<T>(json, length, callback, order, threads));
 }
 
+template <typename T, typename F>
+UpdateStatus ReadJsonLinesParallel(const std::string &json, F &&callback,
+                                   ParallelOrder order = ParallelOrder::kInput,
+                                   unsigned threads = 0)
+{
+    return ReadJsonLinesParallel<T>(json.data(), json.size(), callback, order, threads);
+}
+
+// The file is memory mapped where supported
+template <typename T, typename F>
+UpdateStatus ReadJsonLinesFileParallel(const std::string &path, F &&callback,
+                                       ParallelOrder order = ParallelOrder::kInput,
+                                       unsigned threads = 0)
+{
+    return UpdateWith(read::ForEachJsonLineFileParallel<T>(path, callback, order, threads));
+}
+
+// Parses a top-level array into T, a std::vector, with its elements read in
+//  chunks across threads, hardware concurrency when 0. The result matches
+//  CreateWithJson<T>, including the elements kept ahead of an error.
 template <typename T>
-UpdateStatus UpdateWithJson(T &instance, const std::string &json)
+CreateStatus<T> CreateWithJsonParallel(const char *json, std::size_t length, unsigned threads = 0)
 {
-    read::ReadStatus status = read::FromJson(json, instance);
-    return UpdateStatus{status.success(), status.error_message};
+    return CreateWith<T>([&](T &instance) {
+        return read::FromJsonArrayParallel(json, length, instance, threads);
+    });
 }
 
 template <typename T>
-inline UpdateStatus UpdateWithJson(T &instance, const std::string &&json)
+CreateStatus<T> CreateWithJsonParallel(const std::string &json, unsigned threads = 0)
 {
-    return UpdateWithJson(instance, json);
+    return CreateWithJsonParallel<T>(json.data(), json.size(), threads);
 }
 
+// The file is memory mapped where supported
 template <typename T>
-UpdateStatus UpdateWithJsonFile(T &instance, const std::string &path)
+CreateStatus<T> CreateWithJsonFileParallel(const std::string &path, unsigned threads = 0)
 {
-    read::ReadStatus status = read::FromJsonFile(path, instance);
-    return UpdateStatus{status.success(), status.error_message};
+    return CreateWith<T>([&](T &instance) {
+        return read::FromJsonArrayFileParallel(path, instance, threads);
+    });
 }
 
+// Writes each record of a container on its own line, as JSON Lines; the
+//  config's prefix is ignored as every record must stay on one line
 template <typename T>
-inline UpdateStatus UpdateWithJsonFile(T &instance, const std::string &&path)
+inline const std::string ToJsonLines(T &records, const WriteConfig &config)
 {
-    return UpdateWithJsonFile(instance, path);
+    return write::ToJsonLines(records, config);
 }
 
 template <typename T>
-inline const std::string ToJson(T &instance, const WriteConfig &config)
+inline const std::string ToJsonLines(T &records)
 {
-    return write::ToJson(instance, config);
+    return ToJsonLines(records, WriteConfig());
 }
 
 template <typename T>
-inline const std::string ToJson(T &instance, const WriteConfig &&config)
+inline const bool ToJsonLinesFile(T &records, const WriteConfig &config)
 {
-    return ToJson(instance, config);
+    if (config.GetFilename().length() == 0)
+    {
+        return false;
+    }
+
+    return write::ToJsonLinesFile(records, config);
 }
 
 template <typename T>
-inline const std::string ToJson(T &instance)
+inline const bool ToJsonLinesFile(T &records, const std::string &filename)
 {
-    return ToJson(instance, WriteConfig());
+    return ToJsonLinesFile(records, WriteConfig().SetFilename(filename));
 }
 
 template <typename T>
@@ -0,0 +1,116 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_FIELD_MASK_H_
+#define BOUND_FIELD_MASK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include "read/property_index.h"
+
+namespace bound
+{
+
+// Selects which of T's properties are read; the values of the others are
+//  skipped without being materialized. Names are resolved to properties as
+//  the mask is built, at compile time when it is constexpr:
+//
+//      constexpr bound::FieldMask<User> kSummary{"id", "name"};
+template <typename T>
+class FieldMask
+{
+private:
+    using Index = read::PropertyIndex<T>;
+
+    // One bit per property, plus one at kNotFound for keys without one
+    constexpr static std::size_t kWords = Index::kCount / 64 + 1;
+
+    std::uint64_t words_[kWords] = {};
+
+    constexpr void Set(std::size_t index)
+    {
+        words_[index / 64] |= std::uint64_t(1) << (index % 64);
+    }
+
+public:
+    // Selects nothing
+    constexpr FieldMask() = default;
+
+    constexpr FieldMask(std::initializer_list<const char *> names)
+    {
+        for (const char *name : names)
+        {
+            Add(name);
+        }
+    }
+
+    // Selects the property named name; unknown names are ignored
+    constexpr FieldMask &Add(const char *name, std::size_t length)
+    {
+        const std::size_t index = Index::FindConstant(name, length);
+
+        if (index != Index::kNotFound)
+        {
+            Set(index);
+        }
+
+        return *this;
+    }
+
+    constexpr FieldMask &Add(const char *name)
+    {
+        return Add(name, read::KeyLength(name));
+    }
+
+    FieldMask &Add(const std::string &name)
+    {
+        return Add(name.data(), name.size());
+    }
+
+    // Keeps keys without a property of their own in T's dynamic properties
+    //  map, when it has one
+    constexpr FieldMask &AddOtherKeys()
+    {
+        Set(Index::kNotFound);
+        return *this;
+    }
+
+    // Whether the property at index, as found by PropertyIndex<T>, is read
+    constexpr bool Selected(std::size_t index) const
+    {
+        return (words_[index / 64] >> (index % 64)) & 1;
+    }
+};
+
+// Selects every property; the checks fold away
+struct AllFields
+{
+    constexpr bool Selected(std::size_t) const
+    {
+        return true;
+    }
+};
+
+} // namespace bound
+
+#endif
\ No newline at end of file
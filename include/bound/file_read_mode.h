@@ -0,0 +1,41 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_FILE_READ_MODE_H_
+#define BOUND_FILE_READ_MODE_H_
+
+namespace bound
+{
+
+// How a JSON file is brought into memory to be read
+enum class FileReadMode
+{
+    // Buffered fread through a fixed size buffer
+    kStream,
+    // Whole file mapped read only and read sequentially
+    kMapped,
+    // As kMapped with a hint to back the mapping with huge pages
+    kMappedHugePages
+};
+
+} // namespace bound
+
+#endif
\ No newline at end of file
@@ -23,6 +23,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define BOUND_PROPERTY_H_
 
 #include <map>
+#include <cstddef>
 #include "types.h"
 #include "type_traits.h"
 
@@ -45,10 +46,32 @@ struct Property
           name{""},
           is_json_props{true} {}
 
+    constexpr Property(T Class::*member, const char *name, bool is_json_props,
+                       std::size_t reserve, bool required)
+        : member{member},
+          name{name},
+          is_json_props{is_json_props},
+          reserve{reserve},
+          required{required} {}
+
+    // Capacity reserved ahead of reading, e.g. the expected array length
+    constexpr Property Reserve(std::size_t capacity) const
+    {
+        return Property{member, name, is_json_props, capacity, required};
+    }
+
+    // Objects missing the property's key fail to read
+    constexpr Property Required() const
+    {
+        return Property{member, name, is_json_props, reserve, true};
+    }
+
     T Class::*member;
     // Can't use std::string because it is not instantiable in a constexpr
     const char *name;
     const bool is_json_props;
+    std::size_t reserve = 0;
+    bool required = false;
 };
 
 template <typename Class, typename T>
@@ -22,7 +22,12 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef BOUND_READ_ASSIGN_H_
 #define BOUND_READ_ASSIGN_H_
 
+#include <string>
+
+#include "event.h"
 #include "read_target.h"
+#include "../types.h"
+#include "../type_traits.h"
 
 // #define BOUND_READ_ASSIGN_H_DEBUG
 
@@ -82,6 +87,42 @@ Assign(A &a, B &b)
     return false;
 }
 
+// String assign, copied straight from the parser's buffer
+template <typename Alloc>
+bool Assign(std::basic_string<char, std::char_traits<char>, Alloc> &a, const StringRef &b)
+{
+#ifdef BOUND_READ_ASSIGN_H_DEBUG
+    printf("Assign[std::string:StringRef]\n");
+#endif
+    a.assign(b.data, b.length);
+    return true;
+}
+
+inline bool Assign(JsonString &a, const StringRef &b)
+{
+#ifdef BOUND_READ_ASSIGN_H_DEBUG
+    printf("Assign[JsonString:StringRef]\n");
+#endif
+    a.value.assign(b.data, b.length);
+    return true;
+}
+
+// String assign by way of std::string for any other type that accepts one
+template <typename A>
+typename std::enable_if<
+    !is_string<A>::value &&
+        !std::is_same<A, JsonString>::value &&
+        std::is_assignable<A &, std::string>::value,
+    bool>::type
+Assign(A &a, const StringRef &b)
+{
+#ifdef BOUND_READ_ASSIGN_H_DEBUG
+    printf("Assign[std::is_assignable:StringRef]\n");
+#endif
+    a = std::string(b.data, b.length);
+    return true;
+}
+
 } // namespace read
 
 } // namespace bound
@@ -43,6 +43,14 @@ union Value {
     double double_value;
 };
 
+// Non-owning view of a string token. Points into the parser's buffer, or the
+//  source itself when parsing in situ, and is only valid until the next event.
+struct StringRef
+{
+    const char *data;
+    rapidjson::SizeType length;
+};
+
 // Event which saves the current state of json document parsing.
 struct Event : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, Event>
 {
@@ -66,7 +74,7 @@ struct Event : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, Event>
     };
 
     Value value{0};
-    std::string string_value;
+    StringRef string_value{"", 0};
     Type type{Type::kTypeBegin};
 
     // === Rapidjson Setters === //
@@ -159,7 +167,7 @@ struct Event : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, Event>
         printf("<String value=\"%s\"/>\n", str);
 #endif
 
-        string_value = str;
+        string_value = StringRef{str, length};
         type = Type::kTypeString;
 
         return true;
@@ -182,7 +190,7 @@ struct Event : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, Event>
         printf("<Key value=\"%s\"/>\n", str);
 #endif
 
-        string_value = str;
+        string_value = StringRef{str, length};
         type = Type::kTypeKey;
 
         return true;
@@ -274,13 +282,15 @@ struct Event : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, Event>
             return "{\"type\":\"Double\",\"value\":" + std::to_string(value.double_value) + "}";
 
         case Event::kTypeString:
-            return "{\"type\":\"String\",\"value\":\"" + string_value + "\"}";
+            return "{\"type\":\"String\",\"value\":\"" +
+                   std::string(string_value.data, string_value.length) + "\"}";
 
         case Event::kTypeStartObject:
             return "{\"type\":\"StartObject\"}";
 
         case Event::kTypeKey:
-            return "{\"type\":\"Key\",\"value\":\"" + string_value + "\"}";
+            return "{\"type\":\"Key\",\"value\":\"" +
+                   std::string(string_value.data, string_value.length) + "\"}";
 
         case Event::kTypeStartArray:
             return "{\"type\":\"StartArray\"}";
@@ -0,0 +1,1125 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_READ_INCREMENTAL_READER_H_
+#define BOUND_READ_INCREMENTAL_READER_H_
+
+#include <cstddef>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "reader.h"
+#include "skip.h"
+
+namespace bound
+{
+
+namespace read
+{
+
+// Input fed to an IncrementalReader: what earlier chunks left unread, then
+//  the chunk being fed, which is read in place. Only the part of a chunk left
+//  unread when its Feed returns is copied, into the tail.
+class FeedBuffer
+{
+public:
+    // Reads ahead of the stream's position without moving it
+    class Lookahead
+    {
+    public:
+        Lookahead(const char *begin, const char *end,
+                  const char *next, const char *next_end, std::size_t offset)
+            : p_{begin}, end_{end}, next_{next}, next_end_{next_end}, offset_{offset} {}
+
+        bool AtEnd()
+        {
+            if (p_ == end_)
+            {
+                p_ = next_;
+                end_ = next_end_;
+                next_ = next_end_;
+            }
+
+            return p_ == end_;
+        }
+
+        char Peek() const
+        {
+            return *p_;
+        }
+
+        void Advance()
+        {
+            ++p_;
+            ++offset_;
+        }
+
+        std::size_t offset() const
+        {
+            return offset_;
+        }
+
+    private:
+        const char *p_;
+        const char *end_;
+        const char *next_;
+        const char *next_end_;
+        std::size_t offset_;
+    };
+
+    FeedBuffer()
+        : begin_{tail_.data()}, cursor_{begin_}, end_{begin_} {}
+    FeedBuffer(const FeedBuffer &) = delete;
+    FeedBuffer &operator=(const FeedBuffer &) = delete;
+    FeedBuffer(const FeedBuffer &&) = delete;
+    FeedBuffer &operator=(const FeedBuffer &&) = delete;
+
+    // Reads data, after the tail, until End
+    void Begin(const char *data, std::size_t length)
+    {
+        chunk_ = data;
+        chunk_end_ = data + length;
+    }
+
+    // Keeps what the chunk left unread, as it's only borrowed until then
+    void End()
+    {
+        if (is_in_tail_)
+        {
+            const std::size_t read = static_cast<std::size_t>(cursor_ - begin_);
+            tail_.erase(0, read);
+            base_ += read;
+            tail_.append(chunk_, chunk_end_);
+        }
+        else
+        {
+            base_ = Tell();
+            tail_.assign(cursor_, end_);
+            is_in_tail_ = true;
+        }
+
+        chunk_ = nullptr;
+        chunk_end_ = nullptr;
+        begin_ = tail_.data();
+        cursor_ = begin_;
+        end_ = begin_ + tail_.size();
+    }
+
+    // No more chunks follow; the stream then ends
+    void Close()
+    {
+        is_closed_ = true;
+    }
+
+    bool is_closed() const
+    {
+        return is_closed_;
+    }
+
+    char Peek()
+    {
+        return cursor_ != end_ || NextSegment() ? *cursor_ : '\0';
+    }
+
+    char Take()
+    {
+        return cursor_ != end_ || NextSegment() ? *cursor_++ : '\0';
+    }
+
+    std::size_t Tell() const
+    {
+        return base_ + static_cast<std::size_t>(cursor_ - begin_);
+    }
+
+    Lookahead Ahead() const
+    {
+        return is_in_tail_ ? Lookahead(cursor_, end_, chunk_, chunk_end_, Tell())
+                           : Lookahead(cursor_, end_, nullptr, nullptr, Tell());
+    }
+
+    // Runs scanner over the input from offset, which is not before Tell, and
+    //  returns the offset of the byte it stopped at. Once the input runs out
+    //  it returns false, offset then being the input's end.
+    template <typename Scanner>
+    bool Scan(Scanner &scanner, std::size_t &offset) const
+    {
+        const char *segments[][2] = {{cursor_, end_}, {chunk_, chunk_end_}};
+        std::size_t segment_offset = Tell();
+
+        for (std::size_t i = 0; i < (is_in_tail_ ? 2 : 1); ++i)
+        {
+            const char *begin = segments[i][0];
+            const char *end = segments[i][1];
+            const std::size_t length = static_cast<std::size_t>(end - begin);
+
+            if (offset < segment_offset + length)
+            {
+                const char *stop = scanner.Scan(begin + (offset - segment_offset), end);
+                offset = segment_offset + static_cast<std::size_t>(stop - begin);
+
+                if (stop != end)
+                {
+                    return true;
+                }
+            }
+
+            segment_offset += length;
+        }
+
+        offset = segment_offset;
+        return false;
+    }
+
+private:
+    // Moves from the tail to the chunk
+    bool NextSegment()
+    {
+        if (!is_in_tail_ || chunk_ == chunk_end_)
+        {
+            return false;
+        }
+
+        base_ += static_cast<std::size_t>(end_ - begin_);
+        begin_ = chunk_;
+        cursor_ = chunk_;
+        end_ = chunk_end_;
+        is_in_tail_ = false;
+        return true;
+    }
+
+    std::string tail_;
+    const char *chunk_ = nullptr;
+    const char *chunk_end_ = nullptr;
+
+    // The segment being read, tail or chunk, and its offset in the document
+    const char *begin_;
+    const char *cursor_;
+    const char *end_;
+    std::size_t base_ = 0;
+    bool is_in_tail_ = true;
+    bool is_closed_ = false;
+};
+
+// Read stream over a FeedBuffer; copies share the buffer's position
+class FeedStream
+{
+public:
+    typedef char Ch;
+
+    explicit FeedStream(FeedBuffer &buffer)
+        : buffer_{&buffer} {}
+
+    Ch Peek() const
+    {
+        return buffer_->Peek();
+    }
+
+    Ch Take()
+    {
+        return buffer_->Take();
+    }
+
+    std::size_t Tell() const
+    {
+        return buffer_->Tell();
+    }
+
+    // Not writable, needed for compilation
+    Ch *PutBegin() { return nullptr; }
+    void Put(Ch) {}
+    void Flush() {}
+    std::size_t PutEnd(Ch *) { return 0; }
+
+private:
+    FeedBuffer *buffer_;
+};
+
+// Reads one document into instance as its chunks are fed, on the thread
+//  feeding them. rapidjson is only handed tokens that have arrived whole, so
+//  it never meets the end of a chunk; what a Feed can't tokenize waits in the
+//  buffer for the next one. A value that has arrived up to its closing
+//  bracket is read whole by Reader. One still arriving is read event by event
+//  in a frame of its own, the frames standing in for Reader's call stack
+//  between Feeds, or, when it can only be read whole, as into a setter,
+//  JsonRaw, or JsonLazy, waits for the rest of itself.
+template <typename T, typename Config = ReadConfig<>>
+class IncrementalReader
+{
+private:
+    typedef Reader<FeedStream, Config> ValueReader;
+
+    constexpr static bool kComments = Config::kParseFlags & kReadComments;
+    constexpr static bool kStopWhenDone = Config::kParseFlags & kReadStopWhenDone;
+    constexpr static bool kStopWhenFilled = Config::kParseFlags & kReadStopWhenFilled;
+    constexpr static bool kRejectDuplicates = Config::kParseFlags & kReadRejectDuplicateKeys;
+
+    // Objects and arrays Reader reads event by event can be read in frames
+    template <typename V>
+    using is_framed = std::integral_constant<
+        bool,
+        (is_bound<V>::value || is_json_properties<V>::value || is_seq_container<V>::value) &&
+            !is_json_lazy<V>::value &&
+            !std::is_same<V, JsonRaw>::value &&
+            !std::is_assignable<V, JsonRaw>::value>;
+
+    // An object or array begun but not yet ended
+    class Frame
+    {
+    public:
+        virtual ~Frame() = default;
+        // Takes the event just fetched
+        virtual void Read(IncrementalReader &reader) = 0;
+        // The frame above, read into this one's value, has ended
+        virtual void Resume(IncrementalReader &reader) {}
+    };
+
+    // State of Reader::ReadObject
+    template <typename V, bool kStopAtRoot>
+    class ObjectFrame : public Frame
+    {
+    public:
+        V &instance;
+        std::size_t property = 0;
+        std::size_t key_offset = 0;
+        bool last_token_was_key = false;
+        std::set<std::string> other_keys;
+        PropertyPresence<
+            V,
+            is_bound<V>::value &&
+                (kStopAtRoot || kRejectDuplicates || has_required_properties<V>::value)>
+            presence{AllFields()};
+
+        explicit ObjectFrame(V &value)
+            : instance{value} {}
+
+        void Read(IncrementalReader &reader) override
+        {
+            reader.ReadObjectEvent(*this);
+        }
+
+        void Resume(IncrementalReader &reader) override
+        {
+            reader.ResumeObject(*this);
+        }
+    };
+
+    // State of Reader's sequence container Read
+    template <typename V>
+    class ArrayFrame : public Frame
+    {
+    public:
+        V &instance;
+
+        explicit ArrayFrame(V &value)
+            : instance{value} {}
+
+        void Read(IncrementalReader &reader) override
+        {
+            reader.ReadArrayEvent(*this);
+        }
+    };
+
+    // Finds the next token's end, stepping over the whitespace, comments,
+    //  and separator before it. A token ending the document also needs what
+    //  rapidjson then checks follows it. Resumable, as CloseScanner.
+    class TokenScanner
+    {
+    private:
+        enum State
+        {
+            kSpace,
+            kSlash,
+            kLineComment,
+            kBlockComment,
+            kBlockCommentStar,
+            kString,
+            kEscape,
+            kLiteral,
+            kRootEnd
+        };
+
+        State state_ = kSpace;
+        bool has_separator_ = false;
+        bool is_whole_ = false;
+        // Whether a value, or a closing bracket, there ends the document
+        bool is_root_value_ = !kStopWhenDone;
+        bool is_root_close_ = false;
+
+        const char *Found(const char *p, bool is_whole)
+        {
+            is_whole_ = is_whole;
+            return p;
+        }
+
+    public:
+        TokenScanner() = default;
+        explicit TokenScanner(std::size_t frames)
+            : is_root_value_{frames == 0 && !kStopWhenDone},
+              is_root_close_{frames == 1 && !kStopWhenDone} {}
+
+        // Whether the token has arrived whole, once Scan stopped short of end
+        bool is_whole() const
+        {
+            return is_whole_;
+        }
+
+        // Whether only whitespace has followed the root value, which is all
+        //  rapidjson needs of the input that has arrived
+        bool is_past_root() const
+        {
+            return state_ == kRootEnd;
+        }
+
+        // Returns where the token was found whole or found cut short for
+        //  good, or end when more input is needed
+        const char *Scan(const char *p, const char *end)
+        {
+            while (p != end)
+            {
+                switch (state_)
+                {
+                case kSpace:
+                    if (IsSpace(*p))
+                    {
+                        break;
+                    }
+
+                    if (kComments && *p == '/')
+                    {
+                        state_ = kSlash;
+                        break;
+                    }
+
+                    if ((*p == ',' || *p == ':') && !has_separator_)
+                    {
+                        has_separator_ = true;
+                        break;
+                    }
+
+                    switch (*p)
+                    {
+                    case '{':
+                    case '[':
+                        return Found(p, true);
+
+                    case '}':
+                    case ']':
+                        if (!is_root_close_)
+                        {
+                            return Found(p, true);
+                        }
+                        state_ = kRootEnd;
+                        break;
+
+                    case '"':
+                        state_ = kString;
+                        break;
+
+                    default:
+                        state_ = kLiteral;
+                        break;
+                    }
+                    break;
+
+                case kSlash:
+                    if (*p != '/' && *p != '*')
+                    {
+                        // Malformed, left to the parser
+                        return Found(p, true);
+                    }
+                    state_ = *p == '/' ? kLineComment : kBlockComment;
+                    break;
+
+                case kLineComment:
+                    if (*p == '\n')
+                    {
+                        state_ = kSpace;
+                    }
+                    break;
+
+                case kBlockComment:
+                case kBlockCommentStar:
+                    state_ = *p == '*'                                 ? kBlockCommentStar
+                             : state_ == kBlockCommentStar && *p == '/' ? kSpace
+                                                                         : kBlockComment;
+                    break;
+
+                case kString:
+                    // Strings end at the first quote not escaped
+                    p = FindByte<StringBytes>(p, end);
+                    if (p == end)
+                    {
+                        return p;
+                    }
+
+                    if (*p == '\\')
+                    {
+                        state_ = kEscape;
+                    }
+                    else if (*p == '"')
+                    {
+                        if (!is_root_value_)
+                        {
+                            return Found(p, true);
+                        }
+                        state_ = kRootEnd;
+                    }
+                    break;
+
+                case kEscape:
+                    state_ = kString;
+                    break;
+
+                case kLiteral:
+                    // Numbers and literals end at the first byte not their own
+                    if (IsLiteral(*p))
+                    {
+                        break;
+                    }
+
+                    if (!is_root_value_)
+                    {
+                        return Found(p, true);
+                    }
+                    state_ = kRootEnd;
+                    continue;
+
+                case kRootEnd:
+                    if (IsSpace(*p))
+                    {
+                        break;
+                    }
+
+                    // A comment after the root value waits for Finish, as
+                    //  rapidjson would fail one cut short
+                    return Found(p, !kComments || *p != '/');
+                }
+
+                ++p;
+            }
+
+            return p;
+        }
+    };
+
+    // Value without a property, counting brackets to its end
+    class SkipFrame : public Frame
+    {
+    public:
+        std::size_t depth = 1;
+
+        void Read(IncrementalReader &reader) override
+        {
+            reader.SkipEvent(*this);
+        }
+    };
+
+    T &instance_;
+    FeedBuffer buffer_;
+    Parser<FeedStream, Config> parser_{FeedStream(buffer_)};
+    ReadStatus status_;
+    ValueReader value_reader_{parser_, status_};
+    std::vector<std::unique_ptr<Frame>> frames_;
+
+    // The current event starts a value that must arrive whole to be read
+    bool is_waiting_ = false;
+    // Where the value being waited for starts, and how far it was scanned
+    std::size_t scan_start_ = 0;
+    std::size_t scan_offset_ = 0;
+    CloseScanner scanner_;
+    // Where the next token is looked for, and how far it was scanned
+    std::size_t token_start_ = 0;
+    std::size_t token_offset_ = 0;
+    TokenScanner token_scanner_;
+
+    bool is_done_ = false;
+    bool is_stopped_ = false;
+    bool is_finished_ = false;
+
+    // === Input arrival === //
+
+    static bool IsSpace(char c)
+    {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+    static bool IsLiteral(char c)
+    {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+               c == '-' || c == '+' || c == '.';
+    }
+
+    // Skips whitespace and comments; false when a comment is cut short
+    bool SkipSpace(FeedBuffer::Lookahead &in) const
+    {
+        while (!in.AtEnd())
+        {
+            if (IsSpace(in.Peek()))
+            {
+                in.Advance();
+                continue;
+            }
+
+            if (!kComments || in.Peek() != '/')
+            {
+                return true;
+            }
+
+            in.Advance();
+            if (in.AtEnd())
+            {
+                return false;
+            }
+
+            const char kind = in.Peek();
+            in.Advance();
+
+            if (kind == '/')
+            {
+                while (!in.AtEnd() && in.Peek() != '\n')
+                {
+                    in.Advance();
+                }
+
+                // The end of the input ends a line comment too
+                if (in.AtEnd())
+                {
+                    return buffer_.is_closed();
+                }
+            }
+            else if (kind == '*')
+            {
+                bool star = false;
+
+                for (;;)
+                {
+                    if (in.AtEnd())
+                    {
+                        return false;
+                    }
+
+                    const char c = in.Peek();
+                    in.Advance();
+
+                    if (star && c == '/')
+                    {
+                        break;
+                    }
+
+                    star = c == '*';
+                }
+            }
+            else
+            {
+                // Malformed, left to the parser
+                return true;
+            }
+        }
+
+        return true;
+    }
+
+    // Whether the next token, and the separator before it, have arrived
+    //  whole, as rapidjson takes both in one event; the scan resumes where
+    //  the last Feed's input ran out
+    bool HasNextToken()
+    {
+        const std::size_t start = buffer_.Tell();
+
+        if (start != token_start_)
+        {
+            token_start_ = start;
+            token_offset_ = start;
+            token_scanner_ = TokenScanner(frames_.size());
+        }
+
+        if (buffer_.Scan(token_scanner_, token_offset_))
+        {
+            return token_scanner_.is_whole();
+        }
+
+        return token_scanner_.is_past_root();
+    }
+
+    // Whether the object or array just started has arrived up to its closing
+    //  bracket; the scan resumes where the last Feed's input ran out. The
+    //  root value waits for Finish, as rapidjson reads on past its end.
+    bool IsValueComplete()
+    {
+        if (buffer_.is_closed())
+        {
+            return true;
+        }
+
+        if (frames_.empty())
+        {
+            return false;
+        }
+
+        const std::size_t start = parser_.offset();
+
+        if (start != scan_start_)
+        {
+            scan_start_ = start;
+            scan_offset_ = start;
+            scanner_ = CloseScanner();
+        }
+
+        return buffer_.Scan(scanner_, scan_offset_);
+    }
+
+    bool IsIncomplete()
+    {
+        return (parser_.event().type & (Event::kTypeStartObject | Event::kTypeStartArray)) &&
+               !IsValueComplete();
+    }
+
+    // Reads the current event again once its value has arrived whole
+    bool Wait()
+    {
+        is_waiting_ = true;
+        return false;
+    }
+
+    // What follows the root value, fed after rapidjson checked it, must be
+    //  whitespace or comments
+    void CheckTrailing()
+    {
+        FeedBuffer::Lookahead in = buffer_.Ahead();
+
+        if (SkipSpace(in) && in.AtEnd())
+        {
+            return;
+        }
+
+        status_.error = ReadError::kParse;
+        status_.parse_error = rapidjson::kParseErrorDocumentRootNotSingular;
+        status_.offset = in.offset();
+    }
+
+    // === Frames === //
+
+    // Reads the value just started into instance in a frame of its own
+    template <typename V, bool kStopAtRoot = false>
+    typename std::enable_if_t<is_bound<V>::value || is_json_properties<V>::value>
+    Open(V &instance)
+    {
+        value_reader_.Clear(instance);
+        frames_.emplace_back(new ObjectFrame<V, kStopAtRoot>(instance));
+    }
+
+    template <typename V, bool kStopAtRoot = false>
+    typename std::enable_if_t<is_seq_container<V>::value>
+    Open(V &instance)
+    {
+        value_reader_.Clear(instance);
+        frames_.emplace_back(new ArrayFrame<V>(instance));
+    }
+
+    // The frame's value has ended; the one below it carries on
+    void Pop()
+    {
+        frames_.pop_back();
+
+        if (frames_.empty())
+        {
+            is_done_ = true;
+            return;
+        }
+
+        frames_.back()->Resume(*this);
+    }
+
+    void Stop()
+    {
+        parser_.Stop(status_);
+        is_done_ = true;
+        is_stopped_ = true;
+    }
+
+    void ReadRoot()
+    {
+        if (!IsIncomplete())
+        {
+            value_reader_.ReadRoot(instance_);
+            is_done_ = true;
+            return;
+        }
+
+        OpenRoot(instance_, is_framed<T>{});
+    }
+
+    void OpenRoot(T &instance, std::true_type)
+    {
+        Open<T, kStopWhenFilled>(instance);
+    }
+
+    void OpenRoot(T &instance, std::false_type)
+    {
+        Wait();
+    }
+
+    // Members Reader reads in place are opened in place; false while waiting
+    template <typename V, typename M>
+    typename std::enable_if_t<
+        std::is_member_object_pointer<M>::value &&
+            is_framed<typename ReadTarget<M>::type>::value,
+        bool>
+    OpenMember(V &instance, M mop, std::size_t capacity)
+    {
+        value_reader_.Reserve(instance.*(mop), capacity);
+        Open(instance.*(mop));
+        return true;
+    }
+
+    // Setters take their value once it's read whole
+    template <typename V, typename M>
+    typename std::enable_if_t<
+        !(std::is_member_object_pointer<M>::value &&
+          is_framed<typename ReadTarget<M>::type>::value),
+        bool>
+    OpenMember(V &instance, M property, std::size_t capacity)
+    {
+        return Wait();
+    }
+
+    template <typename V, std::size_t I>
+    bool OpenPropertyAt(V &instance)
+    {
+        constexpr auto property = std::get<I>(V::BOUND_PROPS_NAME);
+        return OpenMember(instance, property.member, property.reserve);
+    }
+
+    template <typename V, std::size_t... I>
+    bool OpenPropertyAt(V &instance, std::size_t index, std::index_sequence<I...>)
+    {
+        using Opener = bool (IncrementalReader::*)(V &);
+        const static Opener openers[] = {&IncrementalReader::template OpenPropertyAt<V, I>...};
+        return (this->*openers[index])(instance);
+    }
+
+    template <typename V>
+    bool OpenPropertyAt(V &instance, std::size_t index, std::index_sequence<>)
+    {
+        // Needed for compilation; an empty index never finds a property
+        return true;
+    }
+
+    template <typename V>
+    bool OpenJsonProperty(V &instance, std::true_type)
+    {
+        constexpr auto property = std::get<PropertyIndex<V>::kJsonPropsIndex>(V::BOUND_PROPS_NAME);
+        return OpenProperty(instance.*(property.member), 0);
+    }
+
+    template <typename V>
+    bool OpenJsonProperty(V &instance, std::false_type)
+    {
+        frames_.emplace_back(new SkipFrame());
+        return true;
+    }
+
+    // Opens the value of the property found for the pending key, as
+    //  Reader::SetProperty reads it; false while waiting
+    template <typename V>
+    typename std::enable_if_t<is_bound<V>::value, bool>
+    OpenProperty(V &instance, std::size_t index)
+    {
+        using Index = PropertyIndex<V>;
+
+        if (index != Index::kNotFound)
+        {
+            return OpenPropertyAt(instance, index, std::make_index_sequence<Index::kCount>{});
+        }
+
+        return OpenJsonProperty(
+            instance,
+            std::integral_constant<bool, Index::kJsonPropsIndex != Index::kNotFound>{});
+    }
+
+    template <typename V>
+    typename std::enable_if_t<
+        is_json_properties<V>::value && is_framed<typename V::mapped_type>::value,
+        bool>
+    OpenProperty(V &instance, std::size_t index)
+    {
+        Open(value_reader_.MapEntry(instance));
+        return true;
+    }
+
+    template <typename V>
+    typename std::enable_if_t<
+        is_json_properties<V>::value && !is_framed<typename V::mapped_type>::value,
+        bool>
+    OpenProperty(V &instance, std::size_t index)
+    {
+        return Wait();
+    }
+
+    template <typename V>
+    typename std::enable_if_t<is_framed<typename V::value_type>::value>
+    OpenElement(V &instance)
+    {
+        instance.emplace_back();
+        Open(instance.back());
+    }
+
+    template <typename V>
+    typename std::enable_if_t<!is_framed<typename V::value_type>::value>
+    OpenElement(V &instance)
+    {
+        Wait();
+    }
+
+    // As Reader::ReadObject does for each event
+    template <typename V, bool kStopAtRoot>
+    void ReadObjectEvent(ObjectFrame<V, kStopAtRoot> &frame)
+    {
+        const Event::Type event_type = parser_.event().type;
+
+        if (event_type & ValueReader::kEventTypeStartValue)
+        {
+            if (!frame.last_token_was_key)
+            {
+                parser_.Fail(ReadError::kMissingKey, status_);
+                return;
+            }
+
+            if (!IsIncomplete())
+            {
+                value_reader_.SetProperty(frame.instance, frame.property);
+                frame.last_token_was_key = false;
+                ResumeObject(frame);
+            }
+            else if (OpenProperty(frame.instance, frame.property))
+            {
+                frame.last_token_was_key = false;
+            }
+
+            return;
+        }
+
+        if (event_type == Event::kTypeKey)
+        {
+            if (frame.last_token_was_key)
+            {
+                parser_.Fail(ReadError::kUnassignedKey, status_);
+                status_.property_name = ValueReader::template PropertyName<V>(frame.property);
+                status_.key_offset = frame.key_offset;
+                return;
+            }
+
+            frame.last_token_was_key = true;
+            frame.key_offset = parser_.offset();
+            frame.property = value_reader_.template FindProperty<V>(parser_.event().string_value);
+
+            if (!(frame.presence.Add(frame.property) &&
+                  value_reader_.IsNewKey(frame.instance, frame.property, frame.other_keys)) &&
+                kRejectDuplicates)
+            {
+                parser_.Fail(ReadError::kDuplicateKey, status_);
+                status_.property_name = ValueReader::template PropertyName<V>(frame.property);
+            }
+
+            return;
+        }
+
+        if (event_type != Event::kTypeEndObject)
+        {
+            parser_.Fail(ReadError::kUnexpectedEvent, status_);
+            return;
+        }
+
+        if (const char *missing = frame.presence.FindMissing(AllFields()))
+        {
+            parser_.Fail(ReadError::kMissingProperty, status_);
+            status_.property_name = missing;
+            return;
+        }
+
+        Pop();
+    }
+
+    // A property's value has been read
+    template <typename V, bool kStopAtRoot>
+    void ResumeObject(ObjectFrame<V, kStopAtRoot> &frame)
+    {
+        if (kStopAtRoot && frame.presence.IsFilled() && status_.success())
+        {
+            Stop();
+        }
+    }
+
+    // As Reader's sequence container Read does for each event
+    template <typename V>
+    void ReadArrayEvent(ArrayFrame<V> &frame)
+    {
+        const Event::Type event_type = parser_.event().type;
+
+        if (event_type & ValueReader::kEventTypeStartValue)
+        {
+            if (!IsIncomplete())
+            {
+                value_reader_.ReadElement(frame.instance);
+            }
+            else
+            {
+                OpenElement(frame.instance);
+            }
+
+            return;
+        }
+
+        if (event_type != Event::kTypeEndArray)
+        {
+            parser_.Fail(ReadError::kUnexpectedEvent, status_);
+            return;
+        }
+
+        Pop();
+    }
+
+    void SkipEvent(SkipFrame &frame)
+    {
+        const Event::Type event_type = parser_.event().type;
+
+        if (event_type & (Event::kTypeStartObject | Event::kTypeStartArray))
+        {
+            ++frame.depth;
+        }
+        else if ((event_type & (Event::kTypeEndObject | Event::kTypeEndArray)) && --frame.depth == 0)
+        {
+            Pop();
+        }
+    }
+
+    // Reads events while their tokens have arrived whole
+    void Run()
+    {
+        while (status_.success() && !is_done_)
+        {
+            if (is_waiting_)
+            {
+                if (!IsValueComplete())
+                {
+                    return;
+                }
+
+                is_waiting_ = false;
+            }
+            else if (!buffer_.is_closed() && !HasNextToken())
+            {
+                return;
+            }
+            else if (!parser_.FetchNextEvent())
+            {
+                if (parser_.HasParseError())
+                {
+                    parser_.FailParse(status_);
+                }
+
+                return;
+            }
+
+            if (frames_.empty())
+            {
+                ReadRoot();
+            }
+            else
+            {
+                frames_.back()->Read(*this);
+            }
+
+            // A parse error outranks whatever the reader made of the events
+            //  preceding it
+            if (parser_.HasParseError())
+            {
+                parser_.FailParse(status_);
+            }
+        }
+    }
+
+public:
+    explicit IncrementalReader(T &instance, const Config &config = Config())
+        : instance_{instance} {}
+    IncrementalReader(const IncrementalReader &) = delete;
+    IncrementalReader &operator=(const IncrementalReader &) = delete;
+    IncrementalReader(const IncrementalReader &&) = delete;
+    IncrementalReader &operator=(const IncrementalReader &&) = delete;
+
+    // Reads as much of the document as data completes; data need only live
+    //  until Feed returns. Returns false once the document has failed, so
+    //  the rest of it need not be received.
+    bool Feed(const char *data, std::size_t length)
+    {
+        if (!status_.success())
+        {
+            return false;
+        }
+
+        // Once stopped, or past a root value whatever follows is ignored, the
+        //  rest of the input isn't kept
+        if (is_stopped_ || (is_done_ && kStopWhenDone))
+        {
+            return true;
+        }
+
+        buffer_.Begin(data, length);
+        Run();
+        buffer_.End();
+        return status_.success();
+    }
+
+    bool Feed(const std::string &chunk)
+    {
+        return Feed(chunk.data(), chunk.size());
+    }
+
+    // Ends the input and reads what was waiting for it
+    ReadStatus Finish()
+    {
+        if (!is_finished_)
+        {
+            is_finished_ = true;
+            // rapidjson checked what followed the root value only as far as
+            //  it had arrived
+            const bool check_trailing = is_done_ && !is_stopped_ && !kStopWhenDone;
+
+            buffer_.Close();
+            Run();
+
+            if (check_trailing && status_.success())
+            {
+                CheckTrailing();
+            }
+        }
+
+        return status_;
+    }
+};
+
+} // namespace read
+
+} // namespace bound
+
+#endif
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_READ_JSON_POINTER_H_
+#define BOUND_READ_JSON_POINTER_H_
+
+#include <cstddef>
+#include <limits>
+#include "event.h"
+
+namespace bound
+{
+
+namespace read
+{
+
+// Reference tokens of a JSON Pointer (RFC 6901), walked in place. Tokens
+//  keep their ~0 and ~1 escapes and are compared through them.
+class JsonPointer
+{
+private:
+    const char *position_;
+    const char *end_;
+
+public:
+    JsonPointer(const char *pointer, std::size_t length)
+        : position_{pointer},
+          end_{pointer + length} {}
+
+    // Whether the pointer is empty, naming the whole document, or each of its
+    //  tokens starts with '/' and escapes only as ~0 or ~1
+    bool IsValid() const
+    {
+        if (position_ != end_ && *position_ != '/')
+        {
+            return false;
+        }
+
+        for (const char *p = position_; p != end_; ++p)
+        {
+            if (*p == '~' && (p + 1 == end_ || (p[1] != '0' && p[1] != '1')))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Moves to the next token; false past the last one
+    bool Next(StringRef &token)
+    {
+        if (position_ == end_)
+        {
+            return false;
+        }
+
+        const char *begin = ++position_;
+        while (position_ != end_ && *position_ != '/')
+        {
+            ++position_;
+        }
+
+        token = StringRef{begin, static_cast<rapidjson::SizeType>(position_ - begin)};
+        return true;
+    }
+
+    // Whether the escaped token names key
+    static bool Matches(const StringRef &token, const StringRef &key)
+    {
+        std::size_t k = 0;
+
+        for (std::size_t t = 0; t < token.length; ++t, ++k)
+        {
+            char c = token.data[t];
+            if (c == '~')
+            {
+                c = token.data[++t] == '0' ? '~' : '/';
+            }
+
+            if (k == key.length || key.data[k] != c)
+            {
+                return false;
+            }
+        }
+
+        return k == key.length;
+    }
+
+    // Parses the token as an array index: digits without leading zeros
+    static bool ArrayIndex(const StringRef &token, std::size_t &index)
+    {
+        if (token.length == 0 || (token.length > 1 && token.data[0] == '0'))
+        {
+            return false;
+        }
+
+        index = 0;
+        for (std::size_t i = 0; i < token.length; ++i)
+        {
+            if (token.data[i] < '0' || token.data[i] > '9' ||
+                index > (std::numeric_limits<std::size_t>::max() - 9) / 10)
+            {
+                return false;
+            }
+            index = index * 10 + (token.data[i] - '0');
+        }
+
+        return true;
+    }
+};
+
+} // namespace read
+
+} // namespace bound
+
+#endif
\ No newline at end of file
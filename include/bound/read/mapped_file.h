@@ -0,0 +1,126 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_READ_MAPPED_FILE_H_
+#define BOUND_READ_MAPPED_FILE_H_
+
+#ifndef _WIN32
+
+#include <string>
+#include <cstddef>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace bound
+{
+
+namespace read
+{
+
+// Read only mapping of a whole file, unmapped on destruction
+class MappedFile
+{
+private:
+    const char *data_ = nullptr;
+    std::size_t size_ = 0;
+    bool is_open_ = false;
+
+public:
+    MappedFile(const MappedFile &) = delete;
+    MappedFile(MappedFile &&) = delete;
+
+    MappedFile(const std::string &path, bool huge_pages)
+    {
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return;
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) == 0)
+        {
+            size_ = static_cast<std::size_t>(info.st_size);
+            // Zero length mappings are invalid; an empty file is still open
+            is_open_ = size_ == 0 || Map(fd, huge_pages);
+        }
+
+        // The mapping keeps its own reference to the file
+        close(fd);
+    }
+
+    ~MappedFile()
+    {
+        if (data_)
+        {
+            munmap(const_cast<char *>(data_), size_);
+        }
+    }
+
+    bool is_open() const
+    {
+        return is_open_;
+    }
+
+    const char *data() const
+    {
+        return data_;
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+private:
+    bool Map(int fd, bool huge_pages)
+    {
+        void *address = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            return false;
+        }
+
+        // Advice is only a hint, failures are not errors
+        madvise(address, size_, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+        if (huge_pages)
+        {
+            madvise(address, size_, MADV_HUGEPAGE);
+        }
+#else
+        (void)huge_pages;
+#endif
+
+        data_ = static_cast<const char *>(address);
+        return true;
+    }
+};
+
+} // namespace read
+
+} // namespace bound
+
+#endif
+
+#endif
\ No newline at end of file
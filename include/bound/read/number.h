@@ -0,0 +1,106 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_READ_NUMBER_H_
+#define BOUND_READ_NUMBER_H_
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace bound
+{
+
+namespace read
+{
+
+// Targets numbers are converted into directly; bool is read from true/false
+template <typename T>
+struct is_number
+{
+    constexpr static bool value =
+        std::is_arithmetic<T>::value &&
+        !std::is_same<T, bool>::value;
+};
+
+// Integer to integer: in range when it round trips with its sign
+template <typename T, typename S>
+typename std::enable_if_t<std::is_integral<T>::value && std::is_integral<S>::value, bool>
+NumberCast(S value, T &target)
+{
+    const T cast = static_cast<T>(value);
+
+    if (static_cast<S>(cast) != value || (cast < T()) != (value < S()))
+    {
+        return false;
+    }
+
+    target = cast;
+    return true;
+}
+
+// Integer to floating point: always in range, rounded to the nearest
+template <typename T, typename S>
+typename std::enable_if_t<std::is_floating_point<T>::value && std::is_integral<S>::value, bool>
+NumberCast(S value, T &target)
+{
+    target = static_cast<T>(value);
+    return true;
+}
+
+// Floating point to floating point: a finite value must not overflow
+template <typename T>
+typename std::enable_if_t<std::is_floating_point<T>::value, bool>
+NumberCast(double value, T &target)
+{
+    if (std::fabs(value) > static_cast<double>(std::numeric_limits<T>::max()) &&
+        std::isfinite(value))
+    {
+        return false;
+    }
+
+    target = static_cast<T>(value);
+    return true;
+}
+
+// Floating point to integer: only whole numbers within range, as 1e3
+template <typename T>
+typename std::enable_if_t<std::is_integral<T>::value, bool>
+NumberCast(double value, T &target)
+{
+    // Exclusive upper bound, 2^digits, is exact as a double
+    const double upper = std::ldexp(1.0, std::numeric_limits<T>::digits);
+    const double lower = std::is_signed<T>::value ? -upper : 0.0;
+
+    if (!(value >= lower && value < upper) || std::trunc(value) != value)
+    {
+        return false;
+    }
+
+    target = static_cast<T>(value);
+    return true;
+}
+
+} // namespace read
+
+} // namespace bound
+
+#endif
\ No newline at end of file
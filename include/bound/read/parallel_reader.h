@@ -0,0 +1,673 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+
+#ifndef BOUND_READ_PARALLEL_READER_H_
+#define BOUND_READ_PARALLEL_READER_H_
+
+#ifndef BOUND_PARALLEL_CHUNK_SIZE
+#define BOUND_PARALLEL_CHUNK_SIZE (1 << 20)
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "reader.h"
+#include "../parallel_order.h"
+
+namespace bound
+{
+
+namespace read
+{
+
+// Task indexes of one worker; the owner takes from the front and thieves
+//  take from the back
+class WorkDeque
+{
+private:
+    std::mutex mutex_;
+    std::deque<std::size_t> tasks_;
+
+public:
+    void Push(std::size_t task)
+    {
+        tasks_.push_back(task);
+    }
+
+    bool PopFront(std::size_t &task)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty())
+        {
+            return false;
+        }
+        task = tasks_.front();
+        tasks_.pop_front();
+        return true;
+    }
+
+    bool PopBack(std::size_t &task)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty())
+        {
+            return false;
+        }
+        task = tasks_.back();
+        tasks_.pop_back();
+        return true;
+    }
+};
+
+// Hands a worker its next task, stealing once its own deque is empty
+class WorkSource
+{
+private:
+    std::vector<WorkDeque> &deques_;
+    const std::size_t worker_;
+
+public:
+    WorkSource(std::vector<WorkDeque> &deques, std::size_t worker)
+        : deques_{deques},
+          worker_{worker} {}
+
+    bool Next(std::size_t &task)
+    {
+        if (deques_[worker_].PopFront(task))
+        {
+            return true;
+        }
+
+        for (std::size_t i = 1; i < deques_.size(); ++i)
+        {
+            if (deques_[(worker_ + i) % deques_.size()].PopBack(task))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+inline unsigned WorkerCount(unsigned threads)
+{
+    if (threads == 0)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    return std::max(threads, 1u);
+}
+
+// Runs worker(WorkSource &) on each of threads threads, the calling thread
+//  included. Tasks [0, count) are dealt out in contiguous runs.
+template <typename F>
+void RunWorkStealing(unsigned threads, std::size_t count, F &&worker)
+{
+    std::vector<WorkDeque> deques(threads);
+    for (std::size_t task = 0; task < count; ++task)
+    {
+        deques[task * threads / count].Push(task);
+    }
+
+    auto run = [&](std::size_t index) {
+        WorkSource source{deques, index};
+        worker(source);
+    };
+
+    std::vector<std::thread> pool;
+    for (std::size_t index = 1; index < threads; ++index)
+    {
+        pool.emplace_back(run, index);
+    }
+
+    run(0);
+
+    for (auto &thread : pool)
+    {
+        thread.join();
+    }
+}
+
+// Byte range of whole lines
+struct Chunk
+{
+    const char *begin;
+    const char *end;
+};
+
+// Splits json into chunks of about size bytes, each ending after a newline
+inline std::vector<Chunk> SplitLines(const char *json, std::size_t length, std::size_t size)
+{
+    std::vector<Chunk> chunks;
+    const char *end = json + length;
+
+    for (const char *begin = json; begin < end;)
+    {
+        const char *split = begin + std::min(size, static_cast<std::size_t>(end - begin));
+        const char *newline = split < end
+                                  ? static_cast<const char *>(std::memchr(split, '\n', end - split))
+                                  : nullptr;
+        split = newline ? newline + 1 : end;
+
+        chunks.push_back(Chunk{begin, split});
+        begin = split;
+    }
+
+    return chunks;
+}
+
+// Parses JSON Lines in chunks on a work stealing pool, one Parser and Reader
+//  per worker. The callback is never called concurrently.
+template <typename T, typename F>
+class ParallelLinesReader
+{
+private:
+    const ParallelOrder order_;
+    F &callback_;
+    std::vector<Chunk> chunks_;
+
+    std::mutex mutex_;
+    // Parsed records of chunks waiting for earlier ones, in input order
+    std::vector<std::vector<T>> pending_;
+    std::vector<bool> is_parsed_;
+    std::size_t next_chunk_ = 0;
+
+    // First chunk to fail; later chunks are skipped
+    std::atomic<std::size_t> failed_chunk_{std::numeric_limits<std::size_t>::max()};
+    ReadStatus error_status_;
+
+    // Reads a chunk's records; returns false with the error in status on
+    //  failure
+    bool ParseChunk(Parser<rapidjson::MemoryStream> &parser, std::size_t index,
+                    std::vector<T> &records, ReadStatus &status)
+    {
+        const Chunk &chunk = chunks_[index];
+        parser.Reset(rapidjson::MemoryStream(chunk.begin, chunk.end - chunk.begin));
+        Reader<rapidjson::MemoryStream> reader{parser, status};
+
+        for (;;)
+        {
+            records.emplace_back();
+            if (!reader.ReadNextLine(records.back()))
+            {
+                records.pop_back();
+                break;
+            }
+        }
+
+        if (status.success())
+        {
+            return true;
+        }
+
+        // Located within the whole input rather than the chunk
+        status.part = ReadStatus::kChunk;
+        status.part_index = records.size() + 1;
+        status.part_offset = chunk.begin - chunks_[0].begin;
+        status.offset += chunk.begin - chunks_[0].begin;
+        return false;
+    }
+
+    void Deliver(std::vector<T> &records)
+    {
+        for (auto &record : records)
+        {
+            callback_(record);
+        }
+        std::vector<T>().swap(records);
+    }
+
+    // Hands over the chunk's records and any later ones it was holding up
+    void Complete(std::size_t index, std::vector<T> &records)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (order_ == ParallelOrder::kCompletion)
+        {
+            Deliver(records);
+            return;
+        }
+
+        pending_[index].swap(records);
+        is_parsed_[index] = true;
+
+        while (next_chunk_ < chunks_.size() && is_parsed_[next_chunk_] &&
+               next_chunk_ <= failed_chunk_)
+        {
+            Deliver(pending_[next_chunk_++]);
+        }
+    }
+
+    void Fail(std::size_t index, ReadStatus &&status)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (index < failed_chunk_)
+        {
+            failed_chunk_ = index;
+            error_status_ = std::move(status);
+        }
+    }
+
+    void Work(WorkSource &source)
+    {
+        Parser<rapidjson::MemoryStream> parser{rapidjson::MemoryStream(nullptr, 0)};
+        std::size_t index;
+
+        while (source.Next(index))
+        {
+            // Nothing after a failure is delivered
+            if (index > failed_chunk_)
+            {
+                continue;
+            }
+
+            std::vector<T> records;
+            ReadStatus status;
+            const bool success = ParseChunk(parser, index, records, status);
+
+            if (!success)
+            {
+                Fail(index, std::move(status));
+            }
+
+            // Records ahead of an error are delivered, as when reading serially
+            Complete(index, records);
+        }
+    }
+
+public:
+    ParallelLinesReader(ParallelOrder order, F &callback)
+        : order_{order},
+          callback_{callback} {}
+    ParallelLinesReader(const ParallelLinesReader &) = delete;
+    ParallelLinesReader &operator=(const ParallelLinesReader &) = delete;
+    ParallelLinesReader(const ParallelLinesReader &&) = delete;
+    ParallelLinesReader &operator=(const ParallelLinesReader &&) = delete;
+
+    ReadStatus Read(const char *json, std::size_t length, unsigned threads)
+    {
+        threads = WorkerCount(threads);
+
+        // Enough chunks for workers to balance each other
+        const std::size_t size = std::max<std::size_t>(
+            std::min<std::size_t>(BOUND_PARALLEL_CHUNK_SIZE, length / (threads * 8)),
+            1 << 12);
+        chunks_ = SplitLines(json, length, size);
+        pending_.resize(chunks_.size());
+        is_parsed_.resize(chunks_.size());
+
+        if (!chunks_.empty())
+        {
+            RunWorkStealing(
+                static_cast<unsigned>(std::min<std::size_t>(threads, chunks_.size())),
+                chunks_.size(),
+                [&](WorkSource &source) { Work(source); });
+        }
+
+        return std::move(error_status_);
+    }
+};
+
+template <typename T, typename F>
+ReadStatus ForEachJsonLineParallel(const char *json, std::size_t length, F &&callback,
+                                   ParallelOrder order, unsigned threads)
+{
+    return ParallelLinesReader<T, F>(order, callback).Read(json, length, threads);
+}
+
+// Maps the file, or reads it whole where mapping is unsupported, and hands
+//  its bytes to read
+template <typename F>
+ReadStatus ReadFileBytes(const std::string &path, F &&read)
+{
+#ifndef _WIN32
+    MappedFile file{path, false};
+
+    if (file.is_open())
+    {
+        return read(file.data(), file.size());
+    }
+#else
+    FILE *file = fopen(path.c_str(), BOUND_BOUND_H_READ_MODE);
+
+    if (file)
+    {
+        std::string json;
+        char buffer[BOUND_FILE_READ_BUFFER_SIZE];
+        for (std::size_t count; (count = fread(buffer, 1, sizeof(buffer), file)) > 0;)
+        {
+            json.append(buffer, count);
+        }
+        fclose(file);
+
+        return read(json.data(), json.size());
+    }
+#endif
+
+    ReadStatus status;
+    status.error = ReadError::kFileOpen;
+    status.path = path;
+    return status;
+}
+
+template <typename T, typename F>
+ReadStatus ForEachJsonLineFileParallel(const std::string &path, F &&callback,
+                                       ParallelOrder order, unsigned threads)
+{
+    return ReadFileBytes(path, [&](const char *json, std::size_t length) {
+        return ForEachJsonLineParallel<T>(json, length, callback, order, threads);
+    });
+}
+
+// Elements of a top-level array, first being the index of the first one
+struct ElementChunk
+{
+    const char *begin;
+    const char *end;
+    std::size_t first;
+};
+
+// Structural index of a top-level array: chunks of about size bytes of whole
+//  elements, found by scanning for brackets, quotes, and commas without
+//  parsing. Elements themselves are validated when they are read. Elements
+//  ahead of a malformed or missing end are kept along with the error, the
+//  last of them read as far as the input goes, as when reading serially.
+class ArrayIndex
+{
+private:
+    std::vector<ElementChunk> chunks_;
+    ReadStatus status_;
+
+    static bool IsWhitespace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    static const char *SkipWhitespace(const char *p, const char *end)
+    {
+        while (p < end && IsWhitespace(*p))
+        {
+            ++p;
+        }
+        return p;
+    }
+
+    // Fails as rapidjson would, or with kExpectedArray for another value
+    void Fail(rapidjson::ParseErrorCode code, const char *json, const char *at)
+    {
+        status_.error = code == rapidjson::kParseErrorNone ? ReadError::kExpectedArray : ReadError::kParse;
+        status_.parse_error = code;
+        status_.offset = at - json;
+    }
+
+public:
+    ArrayIndex(const char *json, std::size_t length, std::size_t size)
+    {
+        const char *end = json + length;
+        const char *p = SkipWhitespace(json, end);
+
+        if (p == end)
+        {
+            Fail(rapidjson::kParseErrorDocumentEmpty, json, p);
+            return;
+        }
+
+        if (*p != '[')
+        {
+            Fail(rapidjson::kParseErrorNone, json, p);
+            return;
+        }
+
+        ElementScanner scanner;
+        const char *begin = ++p;
+        const char *element = begin;
+        std::size_t first = 0;
+        std::size_t count = 0;
+
+        for (;;)
+        {
+            p = scanner.Scan(p, end);
+
+            if (p == end || *p == '\0')
+            {
+                // The elements ahead of where the input stops are read as
+                //  when reading serially, the last one cut short included
+                const bool has_element = SkipWhitespace(element, p) != p;
+                const char *last = has_element ? p : element - 1;
+                if (last > begin)
+                {
+                    chunks_.push_back(ElementChunk{begin, last, first});
+                }
+
+                Fail(has_element ? rapidjson::kParseErrorArrayMissCommaOrSquareBracket
+                                 : rapidjson::kParseErrorValueInvalid,
+                     json, p);
+                return;
+            }
+
+            if (*p == ',')
+            {
+                ++count;
+                element = p + 1;
+                if (static_cast<std::size_t>(p - begin) >= size)
+                {
+                    chunks_.push_back(ElementChunk{begin, p, first});
+                    begin = p + 1;
+                    first = count;
+                }
+                ++p;
+                continue;
+            }
+
+            // Closing bracket; an empty array has no elements
+            if (count > 0 || SkipWhitespace(begin, p) != p)
+            {
+                chunks_.push_back(ElementChunk{begin, p, first});
+            }
+            break;
+        }
+
+        if (SkipWhitespace(p + 1, end) != end)
+        {
+            Fail(rapidjson::kParseErrorDocumentRootNotSingular, json, p + 1);
+        }
+    }
+
+    const std::vector<ElementChunk> &chunks() const
+    {
+        return chunks_;
+    }
+
+    const ReadStatus &status() const
+    {
+        return status_;
+    }
+};
+
+// Parses the elements of a top-level array in parallel into shards, one per
+//  chunk, each element read by a Reader as CreateWithJson<std::vector<T>>
+//  would, then spliced together in order
+template <typename T>
+class ParallelArrayReader
+{
+private:
+    const char *json_ = nullptr;
+    std::vector<ElementChunk> chunks_;
+    std::vector<std::vector<T>> shards_;
+
+    std::mutex mutex_;
+    // First chunk to fail; later chunks are skipped
+    std::atomic<std::size_t> failed_chunk_{std::numeric_limits<std::size_t>::max()};
+    ReadStatus error_status_;
+
+    // Reads each element of the chunk into the shard, stopping at an error
+    bool ParseChunk(Parser<rapidjson::MemoryStream> &parser, const ElementChunk &chunk,
+                    std::vector<T> &shard, ReadStatus &status)
+    {
+        ElementScanner scanner;
+        const char *begin = chunk.begin;
+
+        while (begin <= chunk.end)
+        {
+            const char *end = scanner.Scan(begin, chunk.end);
+
+            parser.Reset(rapidjson::MemoryStream(begin, end - begin));
+            shard.emplace_back();
+            Reader<rapidjson::MemoryStream>{parser, status}.Read(shard.back());
+
+            // As when reading serially, an element the reader rejects is
+            //  dropped while one cut short by a parse error is kept
+            if (!status.success() || parser.HasParseError())
+            {
+                const std::size_t element = chunk.first + shard.size() - 1;
+
+                if (parser.HasParseError())
+                {
+                    parser.FailParse(status);
+                }
+                else
+                {
+                    shard.pop_back();
+                }
+
+                // Located within the whole input rather than the element
+                status.part = ReadStatus::kElement;
+                status.part_index = element;
+                status.part_offset = begin - json_;
+                status.offset += begin - json_;
+                return false;
+            }
+
+            begin = end + 1;
+        }
+
+        return true;
+    }
+
+    void Work(WorkSource &source)
+    {
+        Parser<rapidjson::MemoryStream> parser{rapidjson::MemoryStream(nullptr, 0)};
+        std::size_t index;
+
+        while (source.Next(index))
+        {
+            // Nothing after a failure is kept
+            if (index > failed_chunk_)
+            {
+                continue;
+            }
+
+            ReadStatus status;
+            if (!ParseChunk(parser, chunks_[index], shards_[index], status))
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                if (index < failed_chunk_)
+                {
+                    failed_chunk_ = index;
+                    error_status_ = std::move(status);
+                }
+            }
+        }
+    }
+
+public:
+    ParallelArrayReader() = default;
+    ParallelArrayReader(const ParallelArrayReader &) = delete;
+    ParallelArrayReader &operator=(const ParallelArrayReader &) = delete;
+    ParallelArrayReader(const ParallelArrayReader &&) = delete;
+    ParallelArrayReader &operator=(const ParallelArrayReader &&) = delete;
+
+    ReadStatus Read(const char *json, std::size_t length, std::vector<T> &instance, unsigned threads)
+    {
+        threads = WorkerCount(threads);
+        instance.clear();
+        json_ = json;
+
+        // Enough chunks for workers to balance each other
+        const std::size_t size = std::max<std::size_t>(
+            std::min<std::size_t>(BOUND_PARALLEL_CHUNK_SIZE, length / (threads * 8)),
+            1 << 12);
+        ArrayIndex index{json, length, size};
+        chunks_ = index.chunks();
+        shards_.resize(chunks_.size());
+
+        if (chunks_.empty())
+        {
+            return index.status();
+        }
+
+        RunWorkStealing(
+            static_cast<unsigned>(std::min<std::size_t>(threads, chunks_.size())),
+            chunks_.size(),
+            [&](WorkSource &source) { Work(source); });
+
+        // Elements ahead of an error are kept, as when reading serially
+        const std::size_t kept = std::min(failed_chunk_.load(), shards_.size() - 1) + 1;
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < kept; ++i)
+        {
+            count += shards_[i].size();
+        }
+
+        instance.reserve(count);
+        for (std::size_t i = 0; i < kept; ++i)
+        {
+            std::move(shards_[i].begin(), shards_[i].end(), std::back_inserter(instance));
+            std::vector<T>().swap(shards_[i]);
+        }
+
+        // An element's error comes before any the index found after it
+        return error_status_.success() ? index.status() : std::move(error_status_);
+    }
+};
+
+template <typename T>
+ReadStatus FromJsonArrayParallel(const char *json, std::size_t length,
+                                 std::vector<T> &instance, unsigned threads)
+{
+    return ParallelArrayReader<T>().Read(json, length, instance, threads);
+}
+
+template <typename T>
+ReadStatus FromJsonArrayFileParallel(const std::string &path,
+                                     std::vector<T> &instance, unsigned threads)
+{
+    return ReadFileBytes(path, [&](const char *json, std::size_t length) {
+        return FromJsonArrayParallel(json, length, instance, threads);
+    });
+}
+
+} // namespace read
+
+} // namespace bound
+
+#endif
\ No newline at end of file
@@ -22,8 +22,14 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef BOUND_READ_PARSER_H_
 #define BOUND_READ_PARSER_H_
 
+#include <new>
+#include <string>
 #include <rapidjson/reader.h>
+#include <rapidjson/error/en.h>
 #include "event.h"
+#include "read_status.h"
+#include "streams.h"
+#include "../read_config.h"
 
 namespace bound
 {
@@ -31,17 +37,68 @@ namespace bound
 namespace read
 {
 
-// Parser which will tokenize JSON parse events
+// Parse flags a stream requires; in situ streams must be parsed in situ
 template <typename Stream>
+struct stream_parse_flags
+{
+    constexpr static unsigned value = rapidjson::kParseNoFlags;
+};
+
+template <>
+struct stream_parse_flags<InsituStream>
+{
+    constexpr static unsigned value = rapidjson::kParseInsituFlag;
+};
+
+template <>
+struct stream_parse_flags<rapidjson::InsituStringStream>
+{
+    constexpr static unsigned value = rapidjson::kParseInsituFlag;
+};
+
+// Parser which will tokenize JSON parse events
+template <typename Stream, typename Config = ReadConfig<>>
 class Parser
 {
 private:
+    constexpr static unsigned kParseFlags =
+        (Config::kParseFlags & ~kReadReaderFlags) |
+        stream_parse_flags<Stream>::value;
+
     Event event_;
     rapidjson::Reader reader_;
     Stream stream_;
+    SourceCapture<Stream> capture_;
 
     bool is_reader_started_ = false;
     bool is_reader_complete_ = false;
+    // Whether the stream holds several documents, as JSON Lines
+    bool is_multi_document_ = false;
+
+    // Open objects and arrays; past Config::kMaxDepth the parse stops so
+    //  readers never recurse deeper than that
+    std::size_t depth_ = 0;
+    bool is_too_deep_ = false;
+    std::size_t too_deep_offset_ = 0;
+
+    // Readers keep pending keys here so the buffer outlives each document
+    std::string key_buffer_;
+
+    // rapidjson clears its stack of open values and string bytes only at the
+    //  end of the input, so after a parse that stopped short of it, as on an
+    //  error or once filled, a new reader is made rather than the stack left
+    //  to grow with each document
+    void RestartReader()
+    {
+        if (is_reader_started_ && (reader_.HasParseError() || !reader_.IterativeParseComplete()))
+        {
+            using Reader = rapidjson::Reader;
+            reader_.~Reader();
+            new (&reader_) Reader();
+        }
+
+        reader_.IterativeParseInit();
+    }
 
 public:
     Parser(Stream &&stream) : stream_{stream} {}
@@ -55,6 +112,129 @@ public:
         return event_;
     }
 
+    std::string &key_buffer()
+    {
+        return key_buffer_;
+    }
+
+    // Bytes consumed from the source
+    std::size_t offset()
+    {
+        return stream_.Tell();
+    }
+
+    bool HasParseError() const
+    {
+        return is_too_deep_ || reader_.HasParseError();
+    }
+
+    // Records error at the current event in status
+    void Fail(ReadError error, ReadStatus &status)
+    {
+        status.error = error;
+        status.event_type = event_.type;
+        status.event_value = event_.value;
+        status.depth = depth_;
+        status.offset = stream_.Tell();
+    }
+
+    // Records where reading stopped short of the end of the document
+    void Stop(ReadStatus &status)
+    {
+        status.offset = stream_.Tell();
+        status.unread = SourceRemaining(stream_);
+    }
+
+    // Records the parse error in status, replacing any other
+    void FailParse(ReadStatus &status)
+    {
+        status.depth = depth_;
+
+        if (is_too_deep_)
+        {
+            status.error = ReadError::kTooDeep;
+            status.offset = too_deep_offset_;
+            return;
+        }
+
+        status.error = ReadError::kParse;
+        status.parse_error = reader_.GetParseErrorCode();
+        status.offset = reader_.GetErrorOffset();
+    }
+
+    // Whether the source bytes of values can be captured
+    constexpr static bool kCanCapture = SourceCapture<Stream>::kSupported;
+
+    // Start capturing source bytes at the current event
+    void BeginCapture()
+    {
+        capture_.Begin(stream_);
+    }
+
+    // Source bytes from BeginCapture through the current event
+    void EndCapture(std::string &source)
+    {
+        capture_.End(stream_, source);
+    }
+
+    // Moves the stream to the bracket closing the object or array just
+    //  started, without tokenizing its contents. The parser then reads the
+    //  bracket as if the value were empty. Returns false when unsupported,
+    //  or when the config wants what scanning can't check: valid UTF-8, or
+    //  no comments.
+    bool SkipToClose()
+    {
+        constexpr bool kCanScan = (Config::kParseFlags & kReadComments) &&
+                                  !(Config::kParseFlags & kReadValidateEncoding);
+
+        if (!kCanScan || !StreamSkip<Stream>::kSupported)
+        {
+            return false;
+        }
+
+        StreamSkip<Stream>::SkipToClose(stream_);
+        return true;
+    }
+
+    // Starts over on a new stream, keeping the reader's buffers
+    void Reset(Stream &&stream)
+    {
+        stream_ = stream;
+        capture_ = SourceCapture<Stream>();
+        RestartReader();
+        is_reader_started_ = false;
+        is_reader_complete_ = false;
+        is_multi_document_ = false;
+        depth_ = 0;
+        is_too_deep_ = false;
+        event_ = Event();
+    }
+
+    // Starts the next of several whitespace separated documents, as JSON
+    //  Lines. Each document then ends at its root value instead of at the end
+    //  of the stream. Returns false once only whitespace remains.
+    bool NextDocument()
+    {
+        if (HasParseError())
+        {
+            return false;
+        }
+
+        rapidjson::SkipWhitespace(stream_);
+        if (stream_.Peek() == '\0')
+        {
+            return false;
+        }
+
+        RestartReader();
+        is_reader_started_ = true;
+        is_reader_complete_ = false;
+        is_multi_document_ = true;
+        depth_ = 0;
+        event_ = Event();
+        return true;
+    }
+
     // Returns true while there's new events
     bool FetchNextEvent()
     {
@@ -76,7 +256,33 @@ public:
             return false;
         }
 
-        reader_.IterativeParseNext<rapidjson::kParseCommentsFlag>(stream_, event_);
+        capture_.Mark(stream_);
+
+        // rapidjson must not be resumed after an error
+        if (!(is_multi_document_
+                  ? reader_.IterativeParseNext<kParseFlags | rapidjson::kParseStopWhenDoneFlag>(stream_, event_)
+                  : reader_.IterativeParseNext<kParseFlags>(stream_, event_)))
+        {
+            is_reader_complete_ = true;
+            event_.End();
+            return false;
+        }
+
+        if (event_.type & (Event::kTypeStartObject | Event::kTypeStartArray))
+        {
+            if (++depth_ > Config::kMaxDepth)
+            {
+                is_too_deep_ = true;
+                too_deep_offset_ = stream_.Tell();
+                is_reader_complete_ = true;
+                event_.End();
+                return false;
+            }
+        }
+        else if (event_.type & (Event::kTypeEndObject | Event::kTypeEndArray))
+        {
+            --depth_;
+        }
 
         return true;
     }
@@ -0,0 +1,289 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_READ_PROPERTY_INDEX_H_
+#define BOUND_READ_PROPERTY_INDEX_H_
+
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+#include "read_target.h"
+
+namespace bound
+{
+
+namespace read
+{
+
+// Name of an assignable property and its position in the properties tuple
+struct PropertyKey
+{
+    const char *name;
+    std::size_t length;
+    std::size_t index;
+    // Whether any property of the name is required
+    bool required;
+};
+
+// Fixed capacity table of property keys; sized from the properties tuple
+template <std::size_t N>
+struct PropertyKeyTable
+{
+    PropertyKey keys[N == 0 ? 1 : N];
+    std::size_t size;
+};
+
+constexpr std::size_t KeyLength(const char *name)
+{
+    std::size_t length = 0;
+    while (name[length] != '\0')
+    {
+        ++length;
+    }
+    return length;
+}
+
+// Orders keys by length, then by bytes; a length mismatch is resolved without
+//  touching the key's contents
+constexpr int CompareKey(const char *a, std::size_t a_length, const char *b, std::size_t b_length)
+{
+    if (a_length != b_length)
+    {
+        return a_length < b_length ? -1 : 1;
+    }
+
+    for (std::size_t i = 0; i < a_length; ++i)
+    {
+        if (a[i] != b[i])
+        {
+            return static_cast<unsigned char>(a[i]) < static_cast<unsigned char>(b[i]) ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+// Whether the property at index I of T's properties can be set by key
+template <typename T, std::size_t I>
+constexpr bool IsKeyedProperty()
+{
+    return !std::get<I>(T::BOUND_PROPS_NAME).is_json_props &&
+           ReadTarget<decltype(std::get<I>(T::BOUND_PROPS_NAME).member)>::is_assignable;
+}
+
+// Builds the key table sorted by CompareKey. When names repeat, the first
+//  assignable property in the tuple wins, required if any of them is.
+template <typename T, std::size_t... I>
+constexpr PropertyKeyTable<sizeof...(I)> MakePropertyKeyTable(std::index_sequence<I...>)
+{
+    const char *names[] = {std::get<I>(T::BOUND_PROPS_NAME).name..., nullptr};
+    const bool keyed[] = {IsKeyedProperty<T, I>()..., false};
+    const bool required[] = {std::get<I>(T::BOUND_PROPS_NAME).required..., false};
+    PropertyKeyTable<sizeof...(I)> table{};
+
+    // Getters may be marked required in place of their setters
+    for (std::size_t i = 0; i < sizeof...(I); ++i)
+    {
+        if (!keyed[i])
+        {
+            continue;
+        }
+
+        bool is_required = false;
+        for (std::size_t j = 0; j < sizeof...(I); ++j)
+        {
+            is_required = is_required ||
+                          (required[j] && CompareKey(names[i], KeyLength(names[i]), names[j], KeyLength(names[j])) == 0);
+        }
+
+        const std::size_t length = KeyLength(names[i]);
+        std::size_t position = 0;
+        int compare = 1;
+
+        while (position < table.size)
+        {
+            const PropertyKey &key = table.keys[position];
+            compare = CompareKey(key.name, key.length, names[i], length);
+            if (compare >= 0)
+            {
+                break;
+            }
+            ++position;
+        }
+
+        if (position < table.size && compare == 0)
+        {
+            continue;
+        }
+
+        for (std::size_t j = table.size; j > position; --j)
+        {
+            table.keys[j] = table.keys[j - 1];
+        }
+
+        table.keys[position] = PropertyKey{names[i], length, i, is_required};
+        ++table.size;
+    }
+
+    return table;
+}
+
+template <typename T, std::size_t... I>
+constexpr std::size_t FindJsonPropsIndex(std::index_sequence<I...>)
+{
+    const bool json_props[] = {std::get<I>(T::BOUND_PROPS_NAME).is_json_props..., false};
+
+    for (std::size_t i = 0; i < sizeof...(I); ++i)
+    {
+        if (json_props[i])
+        {
+            return i;
+        }
+    }
+
+    return sizeof...(I);
+}
+
+template <std::size_t N>
+constexpr bool HasRequiredKey(const PropertyKeyTable<N> &table)
+{
+    for (std::size_t i = 0; i < table.size; ++i)
+    {
+        if (table.keys[i].required)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Compile-time lookup table resolving a JSON key to its property's index in
+//  T::BOUND_PROPS_NAME with a binary search instead of a scan of every property
+template <typename T>
+struct PropertyIndex
+{
+    constexpr static std::size_t kCount =
+        std::tuple_size<std::remove_const_t<decltype(T::BOUND_PROPS_NAME)>>::value;
+
+    // Returned when no property is found
+    constexpr static std::size_t kNotFound = kCount;
+
+    // Index of the first dynamic properties map, or kNotFound
+    constexpr static std::size_t kJsonPropsIndex =
+        FindJsonPropsIndex<T>(std::make_index_sequence<kCount>{});
+
+    constexpr static PropertyKeyTable<kCount> kTable =
+        MakePropertyKeyTable<T>(std::make_index_sequence<kCount>{});
+
+    // Whether any keyed property is required
+    constexpr static bool kHasRequired = HasRequiredKey(kTable);
+
+    // Name of the keyed property at index, for error messages
+    static const char *Name(std::size_t index)
+    {
+        for (std::size_t i = 0; i < kTable.size; ++i)
+        {
+            if (kTable.keys[i].index == index)
+            {
+                return kTable.keys[i].name;
+            }
+        }
+
+        return "";
+    }
+
+    // As Find, by a scan usable in constant expressions
+    constexpr static std::size_t FindConstant(const char *key, std::size_t length)
+    {
+        for (std::size_t i = 0; i < kTable.size; ++i)
+        {
+            if (CompareKey(kTable.keys[i].name, kTable.keys[i].length, key, length) == 0)
+            {
+                return kTable.keys[i].index;
+            }
+        }
+
+        return kNotFound;
+    }
+
+    // Returns the tuple index of the assignable property named key
+    static std::size_t Find(const char *key, std::size_t length)
+    {
+        std::size_t low = 0;
+        std::size_t high = kTable.size;
+
+        while (low < high)
+        {
+            const std::size_t middle = low + (high - low) / 2;
+            const PropertyKey &candidate = kTable.keys[middle];
+            int compare;
+
+            if (candidate.length != length)
+            {
+                compare = candidate.length < length ? -1 : 1;
+            }
+            else
+            {
+                compare = std::memcmp(candidate.name, key, length);
+            }
+
+            if (compare == 0)
+            {
+                return candidate.index;
+            }
+
+            if (compare < 0)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+
+        return kNotFound;
+    }
+};
+
+template <typename T>
+constexpr std::size_t PropertyIndex<T>::kCount;
+
+template <typename T>
+constexpr std::size_t PropertyIndex<T>::kNotFound;
+
+template <typename T>
+constexpr std::size_t PropertyIndex<T>::kJsonPropsIndex;
+
+template <typename T>
+constexpr PropertyKeyTable<PropertyIndex<T>::kCount> PropertyIndex<T>::kTable;
+
+template <typename T>
+constexpr bool PropertyIndex<T>::kHasRequired;
+
+} // namespace read
+
+} // namespace bound
+
+#endif
\ No newline at end of file
@@ -0,0 +1,153 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_READ_PROPERTY_PRESENCE_H_
+#define BOUND_READ_PROPERTY_PRESENCE_H_
+
+#include <bitset>
+#include <cstddef>
+#include <type_traits>
+#include "property_index.h"
+#include "../type_traits.h"
+
+namespace bound
+{
+
+namespace read
+{
+
+// Tracks which of T's keyed properties an object has set, in a bitset sized
+//  from its properties, to find duplicate keys, missing required properties,
+//  and when all those selected have been set
+template <typename T, bool Enabled = true>
+class PropertyPresence
+{
+private:
+    using Index = PropertyIndex<T>;
+
+    std::bitset<Index::kCount> present_;
+    std::size_t count_ = 0;
+    std::size_t target_ = 0;
+    // A selected dynamic properties map can take keys up to the object's end
+    bool can_fill_ = true;
+
+public:
+    template <typename Fields>
+    PropertyPresence(const Fields &fields)
+        : can_fill_{Index::kJsonPropsIndex == Index::kNotFound ||
+                    !fields.Selected(Index::kNotFound)}
+    {
+        for (std::size_t i = 0; i < Index::kTable.size; ++i)
+        {
+            target_ += fields.Selected(Index::kTable.keys[i].index);
+        }
+    }
+
+    // Marks the property at index, as found by PropertyIndex<T>, present;
+    //  false when it already was
+    bool Add(std::size_t index)
+    {
+        if (index == Index::kNotFound)
+        {
+            return true;
+        }
+
+        if (present_[index])
+        {
+            return false;
+        }
+
+        present_[index] = true;
+        ++count_;
+        return true;
+    }
+
+    // Whether every selected property is present and no other key could
+    //  still be kept
+    bool IsFilled() const
+    {
+        return can_fill_ && count_ == target_;
+    }
+
+    // Name of the first selected required property not present, or nullptr
+    template <typename Fields>
+    const char *FindMissing(const Fields &fields) const
+    {
+        if (!Index::kHasRequired)
+        {
+            return nullptr;
+        }
+
+        for (std::size_t i = 0; i < Index::kTable.size; ++i)
+        {
+            const PropertyKey &key = Index::kTable.keys[i];
+            if (key.required && !present_[key.index] && fields.Selected(key.index))
+            {
+                return key.name;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+// Nothing is tracked, as for maps or when nothing needs it
+template <typename T>
+class PropertyPresence<T, false>
+{
+public:
+    template <typename Fields>
+    PropertyPresence(const Fields &) {}
+
+    constexpr bool Add(std::size_t) const
+    {
+        return true;
+    }
+
+    constexpr bool IsFilled() const
+    {
+        return false;
+    }
+
+    template <typename Fields>
+    constexpr const char *FindMissing(const Fields &) const
+    {
+        return nullptr;
+    }
+};
+
+// Whether T has required properties; false for anything but bound objects
+template <typename T, typename = void>
+struct has_required_properties : std::false_type
+{
+};
+
+template <typename T>
+struct has_required_properties<T, std::enable_if_t<is_bound<T>::value>>
+    : std::integral_constant<bool, PropertyIndex<T>::kHasRequired>
+{
+};
+
+} // namespace read
+
+} // namespace bound
+
+#endif
\ No newline at end of file
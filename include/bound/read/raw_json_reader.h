@@ -29,13 +29,13 @@ namespace read
 {
 
 // Reads parser at it's current depth into a JsonRaw instance
-template <typename Stream>
+template <typename Stream, typename Config = ReadConfig<>>
 class RawJsonReader
 {
-    Parser<Stream> &parser_;
+    Parser<Stream, Config> &parser_;
 
 public:
-    RawJsonReader(Parser<Stream> &parser) : parser_{parser} {}
+    RawJsonReader(Parser<Stream, Config> &parser) : parser_{parser} {}
     RawJsonReader(const RawJsonReader &) = delete;
     RawJsonReader &operator=(const RawJsonReader &) = delete;
     RawJsonReader(const RawJsonReader &&) = delete;
@@ -79,7 +79,9 @@ public:
                 break;
 
             case Event::kTypeString:
-                writer.String(parser_.event().string_value.c_str());
+                writer.String(
+                    parser_.event().string_value.data,
+                    parser_.event().string_value.length);
                 break;
 
             case Event::kTypeStartObject:
@@ -88,7 +90,9 @@ public:
                 break;
 
             case Event::kTypeKey:
-                writer.Key(parser_.event().string_value.c_str());
+                writer.Key(
+                    parser_.event().string_value.data,
+                    parser_.event().string_value.length);
                 break;
 
             case Event::kTypeStartArray:
@@ -122,6 +126,96 @@ public:
     }
 
     void Read(JsonRaw &instance)
+    {
+        Read(instance, std::integral_constant<bool, Parser<Stream, Config>::kCanCapture>{});
+    }
+
+    // As Read, but objects and arrays are scanned for their closing bracket
+    //  instead of tokenized, so their contents are not validated
+    void Scan(JsonRaw &instance)
+    {
+        Scan(instance, std::integral_constant<bool, Parser<Stream, Config>::kCanCapture>{});
+    }
+
+private:
+    // Comments the config allows within the value are not kept, so it can be
+    //  written back as JSON any reader accepts
+    void EndCapture(JsonRaw &instance)
+    {
+        parser_.EndCapture(instance.value);
+
+        if ((Config::kParseFlags & kReadComments) &&
+            instance.value.find('/') != std::string::npos)
+        {
+            StripComments(instance.value);
+        }
+    }
+
+    // Copy the value's bytes from the source as they were written
+    void Read(JsonRaw &instance, std::true_type)
+    {
+        if (parser_.event().type == Event::kTypeBegin)
+        {
+            parser_.FetchNextEvent();
+        }
+
+        parser_.BeginCapture();
+
+        int depth = 0;
+
+        do
+        {
+            const Event::Type type = parser_.event().type;
+
+            if (type & (Event::kTypeStartObject | Event::kTypeStartArray))
+            {
+                ++depth;
+            }
+            else if (type & (Event::kTypeEndObject | Event::kTypeEndArray))
+            {
+                --depth;
+            }
+
+            if (depth == 0)
+            {
+                break;
+            }
+
+        } while (parser_.FetchNextEvent());
+
+        EndCapture(instance);
+    }
+
+    void Scan(JsonRaw &instance, std::true_type)
+    {
+        if (parser_.event().type == Event::kTypeBegin)
+        {
+            parser_.FetchNextEvent();
+        }
+
+        parser_.BeginCapture();
+
+        if (parser_.event().type & (Event::kTypeStartObject | Event::kTypeStartArray))
+        {
+            if (!parser_.SkipToClose())
+            {
+                Read(instance, std::true_type{});
+                return;
+            }
+
+            parser_.FetchNextEvent();
+        }
+
+        EndCapture(instance);
+    }
+
+    void Scan(JsonRaw &instance, std::false_type)
+    {
+        Read(instance, std::false_type{});
+    }
+
+    // Source bytes are not kept, e.g. in situ, so rewrite the value's events
+    void Read(JsonRaw &instance, std::false_type)
     {
         rapidjson::StringBuffer buffer;
         rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
@@ -22,7 +22,11 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef BOUND_READ_STATUS_H_
 #define BOUND_READ_STATUS_H_
 
+#include <cstring>
 #include <string>
+#include <rapidjson/error/en.h>
+#include "event.h"
+#include "../read_error.h"
 
 namespace bound
 {
@@ -30,15 +34,196 @@ namespace bound
 namespace read
 {
 
-// Result of a JSON Read operation
-struct ReadStatus
+// Line and column, from 1, of a byte offset in a document
+struct TextPosition
+{
+    std::size_t line;
+    std::size_t column;
+};
+
+// What went wrong in a JSON Read operation, and where, recorded without
+//  allocating; its message is only formatted when asked for. Shared by
+//  ReadStatus and the statuses of bound.h, which spell success their own way.
+struct ReadStatusBase
 {
-    std::string error_message;
+    ReadError error = ReadError::kNone;
+    // Byte offset in the document where reading stopped
+    std::size_t offset = 0;
+    // Bytes left unread when kReadStopWhenFilled ended a read early, with
+    //  offset where it stopped; 0 when unknown, as for streamed files and
+    //  null terminated strings
+    std::size_t unread = 0;
+
+    // rapidjson's code for kParse errors
+    rapidjson::ParseErrorCode parse_error = rapidjson::kParseErrorNone;
+    // Event being read; strings aren't kept
+    Event::Type event_type = Event::kTypeBegin;
+    Value event_value{0};
+    // Open objects and arrays
+    std::size_t depth = 0;
+    // typeid name of the type being read
+    const char *type_name = nullptr;
+    // Property missing, repeated, or left without a value, for
+    //  kMissingProperty, kDuplicateKey, and kUnassignedKey; nullptr for keys
+    //  without a property of their own
+    const char *property_name = nullptr;
+    // Offset of the key left without a value, for kUnassignedKey
+    std::size_t key_offset = 0;
+    // File which couldn't be opened, for kFileOpen
+    std::string path;
+    // Part of a larger input the document is, formatted only by
+    //  error_message, as "Record 2: "
+    enum Part
+    {
+        kWhole,
+        kRecord,
+        kDocument,
+        kElement,
+        kChunk
+    };
+    Part part = kWhole;
+    // Index of the record, document, or element
+    std::size_t part_index = 0;
+    // Byte offset of the element or chunk in the input
+    std::size_t part_offset = 0;
+
+    // Line and column of offset in json, the source read. Only the offset is
+    //  kept, so failures stay cheap; this scans json up to it. In situ
+    //  sources are decoded over, so pass an unmodified copy.
+    TextPosition position(const char *json) const
+    {
+        const char *end = json + offset;
+        const char *line_begin = json;
+        TextPosition position{1, 0};
+
+        for (const char *p = json;
+             (p = static_cast<const char *>(memchr(p, '\n', end - p))) != nullptr;
+             line_begin = ++p)
+        {
+            ++position.line;
+        }
+
+        position.column = end - line_begin + 1;
+        return position;
+    }
+
+    const std::string error_message() const
+    {
+        switch (error)
+        {
+        case ReadError::kNone:
+            return "";
+
+        case ReadError::kParse:
+            return Prefix() + rapidjson::GetParseError_En(parse_error) + Where();
+
+        case ReadError::kTooDeep:
+            return Prefix() + "Nesting deeper than " + std::to_string(depth - 1) +
+                   " objects and arrays." + Where();
+
+        case ReadError::kMissingKey:
+            return Prefix() + "No key found for " + EventString() + "." + Where();
+
+        case ReadError::kUnassignedKey:
+            return Prefix() + "Unassigned key" +
+                   (property_name == nullptr ? "" : " \"" + std::string(property_name) + "\"") +
+                   " at offset " + std::to_string(key_offset) + "; found new key." + Where();
+
+        case ReadError::kUnexpectedEvent:
+            return Prefix() + "Unexpected event " + EventString() + "." + Where();
+
+        case ReadError::kCannotAssign:
+            return Prefix() + "Cannot assign type \"" + type_name +
+                   "\" with event " + EventString() + "." + Where();
+
+        case ReadError::kOutOfRange:
+            return Prefix() + "Number out of range for type \"" + type_name +
+                   "\" with event " + EventString() + "." + Where();
+
+        case ReadError::kExpectedArray:
+            return Prefix() + "Expected an array" +
+                   (event_type == Event::kTypeBegin ? "." : "; found " + EventString() + ".") +
+                   Where();
+
+        case ReadError::kFileOpen:
+            return Prefix() + "Unable to open file \"" + path + "\".";
 
+        case ReadError::kNotFound:
+            return Prefix() + "No value at the JSON Pointer." + Where();
+
+        case ReadError::kInvalidPointer:
+            return Prefix() + "Invalid JSON Pointer.";
+
+        case ReadError::kMissingProperty:
+            return Prefix() + "Missing required property \"" + property_name + "\"." + Where();
+
+        case ReadError::kDuplicateKey:
+            return Prefix() + (property_name == nullptr
+                                 ? std::string("Duplicate key.")
+                                 : "Duplicate key \"" + std::string(property_name) + "\".") +
+                   Where();
+        }
+
+        return Prefix() + "Unknown error." + Where();
+    }
+
+private:
+    const std::string EventString() const
+    {
+        switch (event_type)
+        {
+        case Event::kTypeString:
+            return "{\"type\":\"String\"}";
+
+        case Event::kTypeKey:
+            return "{\"type\":\"Key\"}";
+
+        default:
+            Event event;
+            event.type = event_type;
+            event.value = event_value;
+            return event.ToString();
+        }
+    }
+
+    const std::string Prefix() const
+    {
+        switch (part)
+        {
+        case kWhole:
+            break;
+
+        case kRecord:
+            return "Record " + std::to_string(part_index) + ": ";
+
+        case kDocument:
+            return "Document " + std::to_string(part_index) + ": ";
+
+        case kElement:
+            return "Element " + std::to_string(part_index) +
+                   " at byte " + std::to_string(part_offset) + ": ";
+
+        case kChunk:
+            return "Chunk at byte " + std::to_string(part_offset) +
+                   ", record " + std::to_string(part_index) + ": ";
+        }
+
+        return "";
+    }
+
+    const std::string Where() const
+    {
+        return " Offset " + std::to_string(offset) + ".";
+    }
+};
+
+// Result of a JSON Read operation
+struct ReadStatus : ReadStatusBase
+{
     // Whether the read was successful
     bool success() const
     {
-        return error_message.length() == 0;
+        return error == ReadError::kNone;
     };
 };
 
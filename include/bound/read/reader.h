@@ -33,12 +33,21 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #endif
 
 #include "parser.h"
+#include "property_index.h"
 #include "read_target.h"
 #include "assign.h"
 #include "read_status.h"
 #include "../type_traits.h"
 #include "raw_json_reader.h"
-#include <rapidjson/filereadstream.h>
+#include "number.h"
+#include "json_pointer.h"
+#include "property_presence.h"
+#include "mapped_file.h"
+#include "../file_read_mode.h"
+#include "../read_context.h"
+#include "../field_mask.h"
+#include <rapidjson/memorystream.h>
+#include <set>
 
 // #define BOUND_READ_READER_H_DEBUG
 
@@ -47,10 +56,17 @@ namespace bound
 namespace read
 {
 
-template <typename Stream>
+template <typename T, typename Config>
+std::string ParseLazy(const std::string &source, T &value);
+
+template <typename Stream, typename Config = ReadConfig<>>
 class Reader
 {
 private:
+    // Reads the values of a document fed in chunks once they have arrived
+    template <typename, typename>
+    friend class IncrementalReader;
+
     const static unsigned int kEventTypeStartValue =
         Event::kTypeNull |
         Event::kTypeBool |
@@ -63,10 +79,16 @@ private:
         Event::kTypeStartObject |
         Event::kTypeStartArray;
 
-    Parser<Stream> &parser_;
+    constexpr static bool kStopWhenFilled = Config::kParseFlags & kReadStopWhenFilled;
+    constexpr static bool kRejectDuplicates = Config::kParseFlags & kReadRejectDuplicateKeys;
+
+    Parser<Stream, Config> &parser_;
     ReadStatus &read_status_;
+    // Key awaiting its value when it must outlive the parser's buffer
+    std::string &key_;
 
-    // Recusively skips unmapped sections of json
+    // Skips unmapped sections of json; by counting brackets when the stream
+    //  can't be scanned directly
     void Skip()
     {
         if (parser_.event().IsSimple())
@@ -75,26 +97,48 @@ private:
             return;
         }
 
+        // Scan the raw bytes to the closing bracket, then read it
+        if (parser_.SkipToClose())
+        {
+            parser_.FetchNextEvent();
+            return;
+        }
+
         const static unsigned long start_complex = Event::kTypeStartArray | Event::kTypeStartObject;
         const static unsigned long end_complex = Event::kTypeEndArray | Event::kTypeEndObject;
 
-        while (parser_.FetchNextEvent() && !(parser_.event().type & end_complex))
+        // The parser matches brackets, so counting them finds the close
+        std::size_t depth = 1;
+
+        while (depth > 0 && parser_.FetchNextEvent())
         {
             if (parser_.event().type & start_complex)
             {
-                // Recurse lest we bail too early
-                Skip();
+                ++depth;
+            }
+            else if (parser_.event().type & end_complex)
+            {
+                --depth;
             }
         }
     }
 
+    // Fail reading a T at the current event
+    template <typename T>
+    void Fail(ReadError error)
+    {
+        parser_.Fail(error, read_status_);
+        read_status_.type_name = typeid(T).name();
+    }
+
     // === Set values via member objer pointer or setter method === //
 
     // Set member object pointer directly
     template <typename T, typename M>
     typename std::enable_if_t<std::is_member_object_pointer<M>::value>
-    Set(T &instance, M mop)
+    Set(T &instance, M mop, std::size_t capacity)
     {
+        Reserve(instance.*(mop), capacity);
         Read(instance.*(mop));
     }
 
@@ -103,9 +147,10 @@ private:
     typename std::enable_if_t<
         is_setter<M>::value &&
         is_setter<M>::arg_is_pointer>
-    Set(T &instance, M property)
+    Set(T &instance, M property, std::size_t capacity)
     {
         typename ReadTarget<M>::type value;
+        Reserve(value, capacity);
         Read(value);
         if (read_status_.success())
         {
@@ -113,18 +158,19 @@ private:
         }
     }
 
-    // Create instance, read into it, and call setter without pointer arg
+    // Create instance, read into it, and hand it over to the setter
     template <typename T, typename M>
     typename std::enable_if_t<
         is_setter<M>::value &&
         !is_setter<M>::arg_is_pointer>
-    Set(T &instance, M property)
+    Set(T &instance, M property, std::size_t capacity)
     {
         typename ReadTarget<M>::type value;
+        Reserve(value, capacity);
         Read(value);
         if (read_status_.success())
         {
-            (instance.*(property))(value);
+            (instance.*(property))(SetterArg<typename is_setter<M>::arg_type>(value));
         }
     }
 
@@ -133,88 +179,312 @@ private:
     typename std::enable_if_t<
         !is_setter<M>::value &&
         !std::is_member_object_pointer<M>::value>
-    Set(T &instance, M property)
+    Set(T &instance, M property, std::size_t capacity)
     {
         // Do nothing, needed for compilation
     }
 
-    // === Property setters for map and bound objects === //
+    // Setters taking a value or rvalue reference are moved into, while
+    //  non-const lvalue references can only bind the read value itself
+    template <typename Arg, typename V>
+    static typename std::enable_if_t<
+        std::is_lvalue_reference<Arg>::value &&
+            !std::is_const<std::remove_reference_t<Arg>>::value,
+        V &>
+    SetterArg(V &value)
+    {
+        return value;
+    }
+
+    template <typename Arg, typename V>
+    static typename std::enable_if_t<
+        !std::is_lvalue_reference<Arg>::value ||
+            std::is_const<std::remove_reference_t<Arg>>::value,
+        V &&>
+    SetterArg(V &value)
+    {
+        return std::move(value);
+    }
 
-    // Set property of map
     template <typename T>
-    void SetProperty(std::map<std::string, T> &instance, std::string &key)
+    inline typename std::enable_if_t<is_reservable<T>::value>
+    Reserve(T &container, std::size_t capacity)
     {
-        T value;
-        Read(value);
-        if (read_status_.success())
+        if (capacity > container.capacity())
         {
-            instance[key] = value;
+            container.reserve(capacity);
         }
     }
 
-    // Set property of bound object
     template <typename T>
-    typename std::enable_if_t<is_bound<T>::value>
-    SetProperty(T &instance, std::string &key)
+    inline typename std::enable_if_t<!is_reservable<T>::value>
+    Reserve(T &instance, std::size_t capacity)
     {
-        bool found = false;
+        // Only sequence containers with capacity can reserve
+    }
+
+    // === Property setters for map and bound objects === //
+
+    // Name of the bound object's property at index for error messages;
+    //  nullptr for keys without a property of their own
+    template <typename T>
+    static typename std::enable_if_t<is_bound<T>::value, const char *>
+    PropertyName(std::size_t index)
+    {
+        return index == PropertyIndex<T>::kNotFound ? nullptr : PropertyIndex<T>::Name(index);
+    }
+
+    template <typename T>
+    static typename std::enable_if_t<!is_bound<T>::value, const char *>
+    PropertyName(std::size_t index)
+    {
+        return nullptr;
+    }
+
+    // Find the bound object's property for key before the parser's key buffer
+    //  is reused by the value's events
+    template <typename T>
+    typename std::enable_if_t<is_bound<T>::value, std::size_t>
+    FindProperty(const StringRef &key)
+    {
+        using Index = PropertyIndex<T>;
 
         // Find explicitly defined property
-        ListProperties(instance, [&](auto &property) {
-            // property.name == "" when it is a json_props map
-            if (property.name != key || !ReadTarget<decltype(property.member)>::is_assignable)
-            {
-                return;
-            }
+        const std::size_t index = Index::Find(key.data, key.length);
+
+        if (index == Index::kNotFound && Index::kJsonPropsIndex != Index::kNotFound)
+        {
+            // Keep the key for the dynamic key collection
+            key_.assign(key.data, key.length);
+        }
+
+        return index;
+    }
+
+    // Keep the map's key until its value is read
+    template <typename T>
+    typename std::enable_if_t<is_json_properties<T>::value, std::size_t>
+    FindProperty(const StringRef &key)
+    {
+        key_.assign(key.data, key.length);
+        return 0;
+    }
 
-            found = true;
-            Set(instance, property.member);
-        });
+    // The pending key as the map's key type
+    template <typename K>
+    typename std::enable_if_t<std::is_same<K, std::string>::value, const std::string &>
+    MapKey()
+    {
+        return key_;
+    }
 
-        // Explicitly defined property not found, find dynamic key collection
-        if (!found)
+    template <typename K>
+    typename std::enable_if_t<!std::is_same<K, std::string>::value, K>
+    MapKey()
+    {
+        return K(key_.data(), key_.size());
+    }
+
+    // The map's entry for the pending key, emptied for its new value
+    template <typename T>
+    typename T::mapped_type &MapEntry(T &instance)
+    {
+        using Value = typename T::mapped_type;
+        const auto &key = MapKey<typename T::key_type>();
+        auto position = instance.lower_bound(key);
+
+        if (position != instance.end() && position->first == key)
         {
-            ListProperties(instance, [&](auto &property) {
-                if (property.is_json_props)
-                {
-                    SetProperty(instance, property.member, key);
-                    found = true;
-                }
-            });
+            // Duplicate keys replace the previous value
+            position->second = Value();
         }
+        else
+        {
+            position = instance.emplace_hint(
+                position,
+                std::piecewise_construct,
+                std::forward_as_tuple(key),
+                std::forward_as_tuple());
+        }
+
+        return position->second;
+    }
 
-        if (!found)
+    // Set property of map; the value is read in place under the pending key
+    template <typename T>
+    typename std::enable_if_t<is_json_properties<T>::value>
+    SetProperty(T &instance, std::size_t index)
+    {
+        Read(MapEntry(instance));
+    }
+
+    // Whether the pending key is new to the object being read, for keys
+    //  without a property of their own; the map is cleared as its object
+    //  starts, so any key already in it is repeated
+    template <typename T>
+    typename std::enable_if_t<is_json_properties<T>::value, bool>
+    IsNewKey(T &instance, std::size_t, std::set<std::string> &)
+    {
+        return !kRejectDuplicates || instance.find(MapKey<typename T::key_type>()) == instance.end();
+    }
+
+    // A bound object's dynamic properties map keeps keys from earlier reads,
+    //  so the keys of the object being read are collected on their own
+    template <typename T>
+    typename std::enable_if_t<is_bound<T>::value, bool>
+    IsNewKey(T &instance, std::size_t index, std::set<std::string> &other_keys)
+    {
+        using Index = PropertyIndex<T>;
+
+        if (!kRejectDuplicates || index != Index::kNotFound || Index::kJsonPropsIndex == Index::kNotFound)
         {
-            Skip();
+            return true;
         }
+
+        return other_keys.insert(key_).second;
     }
 
-    // Set property of child bound object/map
-    template <typename T, typename M>
-    typename std::enable_if_t<
-        is_bound<T>::value &&
-        std::is_member_object_pointer<M>::value>
-    SetProperty(T &instance, M member, std::string &key)
+    // Set the property at index I of the bound object's properties
+    template <typename T, std::size_t I>
+    void SetPropertyAt(T &instance)
     {
-        SetProperty(instance.*(member), key);
+        constexpr auto property = std::get<I>(T::BOUND_PROPS_NAME);
+        Set(instance, property.member, property.reserve);
     }
 
-    template <typename T, typename M>
-    typename std::enable_if_t<
-        !is_bound<T>::value ||
-        !std::is_member_object_pointer<M>::value>
-    SetProperty(T &instance, M member, std::string &key)
+    // Dispatch to the property at a runtime index through a jump table
+    template <typename T, std::size_t... I>
+    void SetPropertyAt(T &instance, std::size_t index, std::index_sequence<I...>)
     {
-        // Needed for compilation
+        using Setter = void (Reader::*)(T &);
+        const static Setter setters[] = {&Reader::template SetPropertyAt<T, I>...};
+        (this->*setters[index])(instance);
     }
 
     template <typename T>
-    typename std::enable_if_t<
-        !is_bound<T>::value &&
-        !is_json_properties<T>::value>
-    SetProperty(T &instance, std::string &key)
+    void SetPropertyAt(T &instance, std::size_t index, std::index_sequence<>)
     {
-        // Needed for compilation
+        // Needed for compilation; an empty index never finds a property
+    }
+
+    // Set pending key of the bound object's dynamic properties map
+    template <typename T>
+    void SetJsonProperty(T &instance, std::true_type)
+    {
+        constexpr auto property = std::get<PropertyIndex<T>::kJsonPropsIndex>(T::BOUND_PROPS_NAME);
+        SetProperty(instance.*(property.member), 0);
+    }
+
+    template <typename T>
+    void SetJsonProperty(T &instance, std::false_type)
+    {
+        // No dynamic properties map to store the key in
+        Skip();
+    }
+
+    // Set property of bound object found by FindProperty
+    template <typename T>
+    typename std::enable_if_t<is_bound<T>::value>
+    SetProperty(T &instance, std::size_t index)
+    {
+        using Index = PropertyIndex<T>;
+
+        if (index != Index::kNotFound)
+        {
+            SetPropertyAt(instance, index, std::make_index_sequence<Index::kCount>{});
+            return;
+        }
+
+        // Explicitly defined property not found, use dynamic key collection
+        SetJsonProperty(
+            instance,
+            std::integral_constant<bool, Index::kJsonPropsIndex != Index::kNotFound>{});
+    }
+
+    // Read the element in place at the back of the container
+    template <typename T>
+    void ReadElement(T &instance)
+    {
+        instance.emplace_back();
+        Read(instance.back());
+        if (!read_status_.success())
+        {
+            instance.pop_back();
+        }
+    }
+
+    // Elements of vector<bool> are not addressable
+    template <typename Alloc>
+    void ReadElement(std::vector<bool, Alloc> &instance)
+    {
+        bool child;
+        Read(child);
+        if (read_status_.success())
+        {
+            instance.push_back(child);
+        }
+    }
+
+    // Only the top-level object may stop once filled
+    template <typename T>
+    typename std::enable_if_t<is_bound<T>::value>
+    ReadRoot(T &instance)
+    {
+        ReadObject<kStopWhenFilled>(instance, AllFields());
+    }
+
+    template <typename T>
+    typename std::enable_if_t<!is_bound<T>::value>
+    ReadRoot(T &instance)
+    {
+        Read(instance);
+    }
+
+    // Moves from the start of an object or array to the value of its member
+    //  or element named by token; false when there is none
+    bool Step(const StringRef &token)
+    {
+        if (parser_.event().type == Event::kTypeStartObject)
+        {
+            while (parser_.FetchNextEvent() && parser_.event().type == Event::kTypeKey)
+            {
+                // Compared before the key's buffer is reused
+                const bool found = JsonPointer::Matches(token, parser_.event().string_value);
+
+                if (!parser_.FetchNextEvent())
+                {
+                    return false;
+                }
+
+                if (found)
+                {
+                    return true;
+                }
+
+                Skip();
+            }
+
+            return false;
+        }
+
+        std::size_t index;
+
+        if (parser_.event().type == Event::kTypeStartArray && JsonPointer::ArrayIndex(token, index))
+        {
+            for (std::size_t i = 0;
+                 parser_.FetchNextEvent() && (parser_.event().type & kEventTypeStartValue);
+                 ++i)
+            {
+                if (i == index)
+                {
+                    return true;
+                }
+
+                Skip();
+            }
+        }
+
+        return false;
     }
 
     void Prime()
@@ -240,14 +510,151 @@ private:
     }
 
 public:
-    Reader(Parser<Stream> &parser, ReadStatus &read_status)
+    Reader(Parser<Stream, Config> &parser, ReadStatus &read_status)
         : parser_{parser},
-          read_status_{read_status} {}
+          read_status_{read_status},
+          key_{parser.key_buffer()} {}
     Reader(const Reader &) = delete;
     Reader &operator=(const Reader &) = delete;
     Reader(const Reader &&) = delete;
     Reader &operator=(const Reader &&) = delete;
 
+    // Reads a whole document; a parse error outranks whatever the reader
+    //  made of the events preceding it
+    template <typename T>
+    void ReadDocument(T &instance)
+    {
+        ReadRoot(instance);
+
+        if (parser_.HasParseError())
+        {
+            parser_.FailParse(read_status_);
+        }
+    }
+
+    // Reads a whole document, only the properties of T selected by fields
+    template <typename T>
+    void ReadDocument(T &instance, const FieldMask<T> &fields)
+    {
+        ReadObject<kStopWhenFilled>(instance, fields);
+
+        if (parser_.HasParseError())
+        {
+            parser_.FailParse(read_status_);
+        }
+    }
+
+    // Reads the value pointer names into instance, skipping everything before
+    //  it. Reading stops once the value is complete, so the rest of the input
+    //  is neither read nor validated.
+    template <typename T>
+    void ReadAt(JsonPointer pointer, T &instance)
+    {
+        StringRef token;
+        Prime();
+
+        while (pointer.Next(token))
+        {
+            if (!Step(token))
+            {
+                if (parser_.HasParseError())
+                {
+                    parser_.FailParse(read_status_);
+                }
+                else
+                {
+                    parser_.Fail(ReadError::kNotFound, read_status_);
+                }
+
+                return;
+            }
+        }
+
+        ReadDocument(instance);
+    }
+
+    // Reads each element of a top-level array over the same instance and
+    //  hands it to callback before the next element is read. As with
+    //  UpdateWithJson, properties an element lacks keep their last value.
+    template <typename T, typename F>
+    void ReadEach(T &instance, F &&callback)
+    {
+        Prime();
+
+        if (parser_.event().type != Event::kTypeStartArray)
+        {
+            if (!parser_.HasParseError())
+            {
+                parser_.Fail(ReadError::kExpectedArray, read_status_);
+            }
+        }
+
+        while (read_status_.success() && parser_.FetchNextEvent())
+        {
+            const Event::Type event_type = parser_.event().type;
+
+            if (event_type & kEventTypeStartValue)
+            {
+                Read(instance);
+                if (read_status_.success())
+                {
+                    callback(instance);
+                }
+                continue;
+            }
+            else if (event_type != Event::kTypeEndArray)
+            {
+                parser_.Fail(ReadError::kUnexpectedEvent, read_status_);
+            }
+
+            break;
+        }
+
+        if (parser_.HasParseError())
+        {
+            parser_.FailParse(read_status_);
+        }
+    }
+
+    // Reads the next whitespace separated document, as JSON Lines, into
+    //  instance. Returns false at the end of the stream or on error.
+    template <typename T>
+    bool ReadNextLine(T &instance)
+    {
+        if (!read_status_.success() || !parser_.NextDocument())
+        {
+            return false;
+        }
+
+        Read(instance);
+
+        if (parser_.HasParseError())
+        {
+            parser_.FailParse(read_status_);
+        }
+
+        return read_status_.success();
+    }
+
+    // Reads each whitespace separated document, as JSON Lines, over the same
+    //  instance and hands it to callback before the next one is read
+    template <typename T, typename F>
+    void ReadLines(T &instance, F &&callback)
+    {
+        std::size_t record = 1;
+
+        for (; ReadNextLine(instance); ++record)
+        {
+            callback(instance);
+        }
+
+        if (!read_status_.success())
+        {
+            read_status_.part = ReadStatus::kRecord;
+            read_status_.part_index = record;
+        }
+    }
+
     template <typename T>
     typename std::enable_if_t<
         is_bound<T>::value ||
@@ -257,9 +664,26 @@ public:
 #ifdef BOUND_READ_READER_H_DEBUG
         printf("Reader#Read[bound|json_properties]\n");
 #endif
-        std::string key;
+        ReadObject<false>(instance, AllFields());
+    }
+
+    // Reads the object's properties selected by fields and skips the rest.
+    //  With kStopAtRoot a bound object stops reading once each of them has
+    //  been set, leaving the parser inside the object.
+    template <bool kStopAtRoot, typename T, typename Fields>
+    void ReadObject(T &instance, const Fields &fields)
+    {
+        std::size_t property = 0;
+        std::size_t key_offset = 0;
         bool last_token_was_key = false;
+        // Keys without a property of their own, when duplicates are rejected
+        std::set<std::string> other_keys;
         Event::Type event_type;
+        PropertyPresence<
+            T,
+            is_bound<T>::value &&
+                (kStopAtRoot || kRejectDuplicates || has_required_properties<T>::value)>
+            presence{fields};
 
         Prime();
         // Reset for a clean slate; only works for maps
@@ -273,11 +697,25 @@ public:
             {
                 if (!last_token_was_key)
                 {
-                    read_status_.error_message = "No key found for " + parser_.event().ToString();
+                    parser_.Fail(ReadError::kMissingKey, read_status_);
                     break;
                 }
 
-                SetProperty(instance, key);
+                if (fields.Selected(property))
+                {
+                    SetProperty(instance, property);
+
+                    if (kStopAtRoot && presence.IsFilled() && read_status_.success())
+                    {
+                        parser_.Stop(read_status_);
+                        break;
+                    }
+                }
+                else
+                {
+                    Skip();
+                }
+
                 last_token_was_key = false;
                 continue;
             }
@@ -286,18 +724,38 @@ public:
             {
                 if (last_token_was_key)
                 {
-                    read_status_.error_message = "Unassigned key: \"" + key + "\"; found new key: " + parser_.event().ToString();
+                    parser_.Fail(ReadError::kUnassignedKey, read_status_);
+                    read_status_.property_name = PropertyName<T>(property);
+                    read_status_.key_offset = key_offset;
                     break;
                 }
 
                 last_token_was_key = true;
-                key = parser_.event().string_value;
+                key_offset = parser_.offset();
+                property = FindProperty<T>(parser_.event().string_value);
+
+                if (fields.Selected(property) &&
+                    !(presence.Add(property) && IsNewKey(instance, property, other_keys)) &&
+                    kRejectDuplicates)
+                {
+                    parser_.Fail(ReadError::kDuplicateKey, read_status_);
+                    read_status_.property_name = PropertyName<T>(property);
+                    break;
+                }
+
                 continue;
             }
 
             if (event_type != Event::kTypeEndObject)
             {
-                read_status_.error_message = "Unexpected token=" + parser_.event().ToString();
+                parser_.Fail(ReadError::kUnexpectedEvent, read_status_);
+                break;
+            }
+
+            if (const char *missing = presence.FindMissing(fields))
+            {
+                parser_.Fail(ReadError::kMissingProperty, read_status_);
+                read_status_.property_name = missing;
             }
 
             break;
@@ -323,17 +781,12 @@ public:
 
             if (event_type & kEventTypeStartValue)
             {
-                typename T::value_type child;
-                Read(child);
-                if (read_status_.success())
-                {
-                    instance.push_back(child);
-                }
+                ReadElement(instance);
                 continue;
             }
             else if (event_type != Event::kTypeEndArray)
             {
-                read_status_.error_message = "Unexpected event=" + parser_.event().ToString();
+                parser_.Fail(ReadError::kUnexpectedEvent, read_status_);
             }
 
             break;
@@ -349,10 +802,10 @@ public:
         printf("Reader#Read[is_assignable:JsonRaw]\n");
 #endif
         JsonRaw json_raw;
-        RawJsonReader<Stream>(parser_).Read(json_raw);
+        RawJsonReader<Stream, Config>(parser_).Read(json_raw);
         if (!Assign(instance, json_raw))
         {
-            read_status_.error_message = "Cannot assign \"" + json_raw.value + "\" to " + typeid(T).name() + ".";
+            Fail<T>(ReadError::kCannotAssign);
         }
     }
 
@@ -362,15 +815,83 @@ public:
 #ifdef BOUND_READ_READER_H_DEBUG
         printf("Reader#Read[JsonRaw]\n");
 #endif
-        RawJsonReader<Stream>(parser_).Read(instance);
+        RawJsonReader<Stream, Config>(parser_).Read(instance);
+    }
+
+    // Keep the value's source to be parsed on access
+    template <typename T>
+    void Read(JsonLazy<T> &instance)
+    {
+#ifdef BOUND_READ_READER_H_DEBUG
+        printf("Reader#Read[JsonLazy]\n");
+#endif
+        JsonRaw json_raw;
+        RawJsonReader<Stream, Config>(parser_).Scan(json_raw);
+        instance.SetSource(std::move(json_raw.value), &ParseLazy<T, Config>);
+    }
+
+    // Numbers are converted straight into the target type; one out of its
+    //  range is an error rather than being narrowed
+    template <typename T>
+    typename std::enable_if_t<is_number<T>::value>
+    Read(T &instance)
+    {
+#ifdef BOUND_READ_READER_H_DEBUG
+        printf("Reader#Read[number] type=%s\n", typeid(instance).name());
+#endif
+        Prime();
+        const Event &event = parser_.event();
+        bool assigned = false;
+
+        switch (event.type)
+        {
+        case Event::kTypeInt:
+            assigned = NumberCast(event.value.int_value, instance);
+            break;
+
+        case Event::kTypeUint:
+            assigned = NumberCast(event.value.unsigned_value, instance);
+            break;
+
+        case Event::kTypeInt64:
+            assigned = NumberCast(event.value.int64_t_value, instance);
+            break;
+
+        case Event::kTypeUint64:
+            assigned = NumberCast(event.value.uint64_t_value, instance);
+            break;
+
+        case Event::kTypeDouble:
+            assigned = NumberCast(event.value.double_value, instance);
+            break;
+
+        case Event::kTypeNull:
+            instance = T();
+            return;
+
+        case Event::kTypeBool:
+            instance = event.value.bool_value;
+            return;
+
+        default:
+            Fail<T>(ReadError::kCannotAssign);
+            return;
+        }
+
+        if (!assigned)
+        {
+            Fail<T>(ReadError::kOutOfRange);
+        }
     }
 
     // Simple object assignment
     template <typename T>
     typename std::enable_if_t<
+        !is_number<T>::value &&
         !is_bound<T>::value &&
         !is_seq_container<T>::value &&
         !is_json_properties<T>::value &&
+        !is_json_lazy<T>::value &&
         !std::is_same<T, JsonRaw>::value &&
         !std::is_assignable<T, JsonRaw>::value>
     Read(T &instance)
@@ -424,45 +945,282 @@ public:
 
         if (!assigned)
         {
-            read_status_.error_message =
-                "Cannot assign type \"" + std::string(typeid(instance).name()) +
-                "\" with event " + parser_.event().ToString() + ".";
+            Fail<T>(ReadError::kCannotAssign);
         }
     }
 };
 
-template <typename T>
-const ReadStatus FromJson(const std::string &json, T &instance)
+template <typename T, typename Config>
+ReadStatus FromJson(BasicReadContext<Config> &context, const char *json, T &instance)
 {
     ReadStatus status;
-    Parser<rapidjson::StringStream> parser{rapidjson::StringStream(json.c_str())};
-    Reader<rapidjson::StringStream>{parser, status}.Read(instance);
+    typename BasicReadContext<Config>::Lease lease{context, json};
+    Reader<rapidjson::StringStream, Config>{lease.parser(), status}.ReadDocument(instance);
     return status;
 }
 
-template <typename T>
-const ReadStatus FromJsonFile(const std::string &path, T &instance)
+// Counts what a read of json, whose length is known, left unread once
+//  filled, as its null terminated stream can't
+template <typename Config>
+ReadStatus CountUnread(ReadStatus status, const std::string &json)
+{
+    if ((Config::kParseFlags & kReadStopWhenFilled) && status.success() && status.offset != 0)
+    {
+        status.unread = json.size() - status.offset;
+    }
+
+    return status;
+}
+
+template <typename T, typename Config>
+ReadStatus FromJson(BasicReadContext<Config> &context, const std::string &json, T &instance)
+{
+    return CountUnread<Config>(FromJson(context, json.c_str(), instance), json);
+}
+
+inline const char *CString(const char *json)
+{
+    return json;
+}
+
+inline const char *CString(const std::string &json)
+{
+    return json.c_str();
+}
+
+// Reads each document into the instance at its index with one lease of the
+//  context's parser and one reader. errors and offsets get each document's
+//  code and the offset reading stopped at; the status returned is the first
+//  failure's, naming its document.
+template <typename T, typename Config, typename Document>
+ReadStatus FromJsonMany(BasicReadContext<Config> &context, const std::vector<Document> &documents,
+                        std::vector<T> &instances, std::vector<ReadError> &errors,
+                        std::vector<std::size_t> &offsets)
 {
+    ReadStatus status;
+    ReadStatus document_status;
+    typename BasicReadContext<Config>::Lease lease{context, ""};
+    Reader<rapidjson::StringStream, Config> reader{lease.parser(), document_status};
+
+    // Created whole, as by CreateWithJson, rather than over previous values
+    instances.clear();
+    instances.resize(documents.size());
+    errors.resize(documents.size());
+    offsets.resize(documents.size());
+
+    for (std::size_t i = 0; i < documents.size(); ++i)
+    {
+        const char *json = CString(documents[i]);
+        lease.parser().Reset(rapidjson::StringStream(json));
+        document_status = ReadStatus();
+        reader.ReadDocument(instances[i]);
+
+        errors[i] = document_status.error;
+        offsets[i] = document_status.offset;
+
+        if (!document_status.success() && status.success())
+        {
+            status = std::move(document_status);
+            status.part = ReadStatus::kDocument;
+            status.part_index = i;
+        }
+    }
+
+    return status;
+}
+
+// Reads with the thread's implicit context for config
+template <typename T, typename Config = ReadConfig<>>
+ReadStatus FromJson(const char *json, T &instance, const Config &config = Config())
+{
+    return FromJson(BasicReadContext<Config>::ThreadLocal(), json, instance);
+}
+
+// Reads only the properties of instance selected by fields
+template <typename T, typename Config = ReadConfig<>>
+ReadStatus FromJson(const char *json, T &instance, const FieldMask<T> &fields,
+                    const Config &config = Config())
+{
+    ReadStatus status;
+    typename BasicReadContext<Config>::Lease lease{BasicReadContext<Config>::ThreadLocal(), json};
+    Reader<rapidjson::StringStream, Config>{lease.parser(), status}.ReadDocument(instance, fields);
+    return status;
+}
+
+template <typename T, typename Config = ReadConfig<>>
+ReadStatus FromJson(const std::string &json, T &instance, const FieldMask<T> &fields,
+                    const Config &config = Config())
+{
+    return CountUnread<Config>(FromJson(json.c_str(), instance, fields, config), json);
+}
+
+template <typename T, typename Config = ReadConfig<>>
+ReadStatus FromJson(const std::string &json, T &instance, const Config &config = Config())
+{
+    return CountUnread<Config>(FromJson(json.c_str(), instance, config), json);
+}
+
+// Reads the value at pointer, a JSON Pointer such as "/items/0/id", into
+//  instance, parsing no further than its end
+template <typename T, typename Config = ReadConfig<>>
+ReadStatus FromJsonAt(const char *json, const char *pointer, std::size_t pointer_length,
+                      T &instance, const Config &config = Config())
+{
+    ReadStatus status;
+    JsonPointer json_pointer{pointer, pointer_length};
+
+    if (!json_pointer.IsValid())
+    {
+        status.error = ReadError::kInvalidPointer;
+        return status;
+    }
+
+    typename BasicReadContext<Config>::Lease lease{BasicReadContext<Config>::ThreadLocal(), json};
+    Reader<rapidjson::StringStream, Config>{lease.parser(), status}.ReadAt(json_pointer, instance);
+    return status;
+}
+
+// Parses in place: json is modified and must outlive any read of the events
+template <typename T, typename Config = ReadConfig<>>
+ReadStatus FromJsonInsitu(char *json, std::size_t length, T &instance,
+                          const Config &config = Config())
+{
+    ReadStatus status;
+    Parser<InsituStream, Config> parser{InsituStream(json, length)};
+    Reader<InsituStream, Config>{parser, status}.ReadDocument(instance);
+    return status;
+}
+
+#ifndef _WIN32
+template <typename Config = ReadConfig<>, typename F>
+ReadStatus ReadMappedJsonFile(const std::string &path, bool huge_pages, F &&read)
+{
+    ReadStatus status;
+    MappedFile file{path, huge_pages};
+
+    if (file.is_open())
+    {
+        Parser<rapidjson::MemoryStream, Config> parser{rapidjson::MemoryStream(file.data(), file.size())};
+        Reader<rapidjson::MemoryStream, Config> reader{parser, status};
+        read(reader);
+    }
+    else
+    {
+        status.error = ReadError::kFileOpen;
+        status.path = path;
+    }
+
+    return status;
+}
+#endif
+
+// Opens path and hands read a Reader over its contents; mapped modes fall
+//  back to kStream where mapping is unsupported
+template <typename Config = ReadConfig<>, typename F>
+ReadStatus ReadJsonFile(const std::string &path, FileReadMode mode, F &&read)
+{
+#ifndef _WIN32
+    if (mode != FileReadMode::kStream)
+    {
+        return ReadMappedJsonFile<Config>(path, mode == FileReadMode::kMappedHugePages, read);
+    }
+#else
+    (void)mode;
+#endif
+
     ReadStatus status;
     char buffer[BOUND_FILE_READ_BUFFER_SIZE];
     FILE *file = fopen(path.c_str(), BOUND_BOUND_H_READ_MODE);
 
     if (file)
     {
-        Parser<rapidjson::FileReadStream> parser{rapidjson::FileReadStream(file, buffer, sizeof(buffer))};
-        Reader<rapidjson::FileReadStream>{parser, status}.Read(instance);
+        Parser<FileStream, Config> parser{FileStream(file, buffer, sizeof(buffer))};
+        Reader<FileStream, Config> reader{parser, status};
+        read(reader);
         fclose(file);
     }
     else
     {
-        status.error_message = "Unable to open file \"" + path + "\".";
+        status.error = ReadError::kFileOpen;
+        status.path = path;
     }
 
     return status;
 }
 
+template <typename T, typename Config = ReadConfig<>>
+ReadStatus FromJsonFile(const std::string &path, T &instance,
+                        FileReadMode mode = FileReadMode::kStream,
+                        const Config &config = Config())
+{
+    return ReadJsonFile<Config>(path, mode, [&](auto &reader) {
+        reader.ReadDocument(instance);
+    });
+}
+
+// Reads a top-level array one element at a time into instance
+template <typename T, typename F>
+ReadStatus ForEachInJson(const char *json, T &instance, F &&callback)
+{
+    ReadStatus status;
+    Parser<rapidjson::StringStream> parser{rapidjson::StringStream(json)};
+    Reader<rapidjson::StringStream>{parser, status}.ReadEach(instance, callback);
+    return status;
+}
+
+template <typename T, typename F>
+ReadStatus ForEachInJsonFile(const std::string &path, T &instance, F &&callback,
+                             FileReadMode mode = FileReadMode::kStream)
+{
+    return ReadJsonFile(path, mode, [&](auto &reader) {
+        reader.ReadEach(instance, callback);
+    });
+}
+
+// Reads whitespace separated documents, as JSON Lines, one at a time into
+//  instance
+template <typename T, typename F>
+ReadStatus ForEachJsonLine(const char *json, T &instance, F &&callback)
+{
+    ReadStatus status;
+    Parser<rapidjson::StringStream> parser{rapidjson::StringStream(json)};
+    Reader<rapidjson::StringStream>{parser, status}.ReadLines(instance, callback);
+    return status;
+}
+
+template <typename T, typename F>
+ReadStatus ForEachJsonLineFile(const std::string &path, T &instance, F &&callback,
+                               FileReadMode mode = FileReadMode::kStream)
+{
+    return ReadJsonFile(path, mode, [&](auto &reader) {
+        reader.ReadLines(instance, callback);
+    });
+}
+
+// Parses a lazy value's source with the config its document was read with
+template <typename T, typename Config>
+std::string ParseLazy(const std::string &source, T &value)
+{
+    return FromJson(source, value, Config()).error_message();
+}
+
 } // namespace read
 
+// Parsed with the string reader, so the source's own stream never needs to
+//  outlive the read
+template <typename T>
+const T &JsonLazy<T>::Get() const
+{
+    if (!parsed_)
+    {
+        parsed_ = true;
+        error_message_ = parse_ ? parse_(source_, value_)
+                                : read::FromJson(source_, value_).error_message();
+    }
+
+    return value_;
+}
+
 } // namespace bound
 
 #endif
\ No newline at end of file
@@ -0,0 +1,332 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_READ_SKIP_H_
+#define BOUND_READ_SKIP_H_
+
+#include <cstddef>
+#include <cstdint>
+
+// Vector kernels are chosen by the target's instruction set, e.g. -mavx2 or
+//  -msse4.2; define BOUND_SKIP_NO_SIMD to always use the scalar kernel
+#ifndef BOUND_SKIP_NO_SIMD
+#if defined(__AVX2__)
+#define BOUND_SKIP_AVX2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__SSE4_2__)
+#define BOUND_SKIP_SSE42
+#include <nmmintrin.h>
+#endif
+#endif
+
+namespace bound
+{
+
+namespace read
+{
+
+#if defined(BOUND_SKIP_AVX2)
+inline int LowestSetBit(unsigned mask)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+#endif
+
+// Bytes that matter between values: brackets, quotes, comments, terminator
+struct ValueBytes
+{
+    static bool Is(char c)
+    {
+        return c == '{' || c == '}' || c == '[' || c == ']' ||
+               c == '"' || c == '/' || c == '\0';
+    }
+
+#if defined(BOUND_SKIP_AVX2)
+    static unsigned Match(__m256i chunk)
+    {
+        __m256i match = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('{'));
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('}')));
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('[')));
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(']')));
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('"')));
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('/')));
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(chunk, _mm256_setzero_si256()));
+        return static_cast<unsigned>(_mm256_movemask_epi8(match));
+    }
+#elif defined(BOUND_SKIP_SSE42)
+    static __m128i Set()
+    {
+        return _mm_setr_epi8('{', '}', '[', ']', '"', '/', '\0', 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    }
+    constexpr static int kSetLength = 7;
+#endif
+};
+
+// Bytes that matter between array elements: as ValueBytes and commas
+struct ElementBytes
+{
+    static bool Is(char c)
+    {
+        return ValueBytes::Is(c) || c == ',';
+    }
+
+#if defined(BOUND_SKIP_AVX2)
+    static unsigned Match(__m256i chunk)
+    {
+        return ValueBytes::Match(chunk) |
+               static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(','))));
+    }
+#elif defined(BOUND_SKIP_SSE42)
+    static __m128i Set()
+    {
+        return _mm_setr_epi8('{', '}', '[', ']', '"', '/', '\0', ',', 0, 0, 0, 0, 0, 0, 0, 0);
+    }
+    constexpr static int kSetLength = 8;
+#endif
+};
+
+// Bytes that matter within a string: its end, escapes, terminator
+struct StringBytes
+{
+    static bool Is(char c)
+    {
+        return c == '"' || c == '\\' || c == '\0';
+    }
+
+#if defined(BOUND_SKIP_AVX2)
+    static unsigned Match(__m256i chunk)
+    {
+        __m256i match = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('"'));
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\')));
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(chunk, _mm256_setzero_si256()));
+        return static_cast<unsigned>(_mm256_movemask_epi8(match));
+    }
+#elif defined(BOUND_SKIP_SSE42)
+    static __m128i Set()
+    {
+        return _mm_setr_epi8('"', '\\', '\0', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    }
+    constexpr static int kSetLength = 3;
+#endif
+};
+
+// First byte of Bytes in [p, end); end is null for null terminated input.
+//  Vector loads are aligned so they never cross into an unmapped page.
+template <typename Bytes>
+inline const char *FindByte(const char *p, const char *end)
+{
+#if defined(BOUND_SKIP_AVX2) || defined(BOUND_SKIP_SSE42)
+#if defined(BOUND_SKIP_AVX2)
+    constexpr std::ptrdiff_t kWidth = 32;
+#else
+    constexpr std::ptrdiff_t kWidth = 16;
+#endif
+
+    while (reinterpret_cast<std::uintptr_t>(p) % kWidth != 0)
+    {
+        if (p == end || Bytes::Is(*p))
+        {
+            return p;
+        }
+        ++p;
+    }
+
+    while (!end || end - p >= kWidth)
+    {
+#if defined(BOUND_SKIP_AVX2)
+        const unsigned mask = Bytes::Match(_mm256_load_si256(reinterpret_cast<const __m256i *>(p)));
+        if (mask)
+        {
+            return p + LowestSetBit(mask);
+        }
+#else
+        const int index = _mm_cmpestri(
+            Bytes::Set(), Bytes::kSetLength,
+            _mm_load_si128(reinterpret_cast<const __m128i *>(p)), 16,
+            _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+        if (index < 16)
+        {
+            return p + index;
+        }
+#endif
+        p += kWidth;
+    }
+#endif
+
+    while (p != end && !Bytes::Is(*p))
+    {
+        ++p;
+    }
+
+    return p;
+}
+
+// Finds the bracket closing a value whose opening bracket was just read,
+//  stepping over nested values, strings, and comments without validating
+//  them. Resumable so buffered streams can scan one buffer at a time. With
+//  ElementBytes it also stops at the commas between an array's elements.
+template <typename Bytes>
+class BracketScanner
+{
+private:
+    enum State
+    {
+        kValue,
+        kString,
+        kEscape,
+        kSlash,
+        kLineComment,
+        kBlockComment,
+        kBlockCommentStar
+    };
+
+    State state_ = kValue;
+    std::size_t depth_ = 0;
+
+public:
+    // Returns the closing bracket, a separating comma, a null byte, or end
+    //  when more input is needed; end is null for null terminated input
+    const char *Scan(const char *p, const char *end)
+    {
+        while (p != end)
+        {
+            switch (state_)
+            {
+            case kValue:
+                p = FindByte<Bytes>(p, end);
+                if (p == end)
+                {
+                    return p;
+                }
+
+                switch (*p)
+                {
+                case '\0':
+                    return p;
+
+                case '{':
+                case '[':
+                    ++depth_;
+                    break;
+
+                case '}':
+                case ']':
+                    if (depth_ == 0)
+                    {
+                        return p;
+                    }
+                    --depth_;
+                    break;
+
+                case ',':
+                    if (depth_ == 0)
+                    {
+                        return p;
+                    }
+                    break;
+
+                case '"':
+                    state_ = kString;
+                    break;
+
+                default: // '/'
+                    state_ = kSlash;
+                    break;
+                }
+                break;
+
+            case kString:
+                p = FindByte<StringBytes>(p, end);
+                if (p == end || *p == '\0')
+                {
+                    return p;
+                }
+                state_ = *p == '"' ? kValue : kEscape;
+                break;
+
+            case kEscape:
+                if (*p == '\0')
+                {
+                    return p;
+                }
+                state_ = kString;
+                break;
+
+            case kSlash:
+                if (*p == '\0')
+                {
+                    return p;
+                }
+                // Anything else is malformed and left to the parser's next read
+                state_ = *p == '*' ? kBlockComment : *p == '/' ? kLineComment : kValue;
+                if (state_ == kValue)
+                {
+                    continue;
+                }
+                break;
+
+            case kLineComment:
+                if (*p == '\0')
+                {
+                    return p;
+                }
+                if (*p == '\n')
+                {
+                    state_ = kValue;
+                }
+                break;
+
+            case kBlockComment:
+            case kBlockCommentStar:
+                if (*p == '\0')
+                {
+                    return p;
+                }
+                state_ = *p == '*'                                 ? kBlockCommentStar
+                         : state_ == kBlockCommentStar && *p == '/' ? kValue
+                                                                     : kBlockComment;
+                break;
+            }
+
+            ++p;
+        }
+
+        return p;
+    }
+};
+
+typedef BracketScanner<ValueBytes> CloseScanner;
+typedef BracketScanner<ElementBytes> ElementScanner;
+
+} // namespace read
+
+} // namespace bound
+
+#endif
\ No newline at end of file
@@ -0,0 +1,512 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_READ_STREAMS_H_
+#define BOUND_READ_STREAMS_H_
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <rapidjson/rapidjson.h>
+#include <rapidjson/memorystream.h>
+#include "skip.h"
+
+namespace bound
+{
+
+namespace read
+{
+
+// Read stream over a mutable buffer of known length for in situ parsing.
+//  Strings are decoded into the buffer itself so events point straight into
+//  the caller's memory. The buffer does not need to be null terminated.
+class InsituStream
+{
+public:
+    typedef char Ch;
+
+    InsituStream(char *src, std::size_t length)
+        : src_{src},
+          dst_{nullptr},
+          head_{src},
+          end_{src + length} {}
+
+    Ch Peek() const
+    {
+        return src_ == end_ ? '\0' : *src_;
+    }
+
+    Ch Take()
+    {
+        return src_ == end_ ? '\0' : *src_++;
+    }
+
+    std::size_t Tell() const
+    {
+        return static_cast<std::size_t>(src_ - head_);
+    }
+
+    // === Write back, used by rapidjson to decode strings in place === //
+
+    Ch *PutBegin()
+    {
+        return dst_ = src_;
+    }
+
+    void Put(Ch c)
+    {
+        *dst_++ = c;
+    }
+
+    void Flush() {}
+
+    std::size_t PutEnd(Ch *begin)
+    {
+        return static_cast<std::size_t>(dst_ - begin);
+    }
+
+    Ch *src_;
+    Ch *dst_;
+    Ch *head_;
+    Ch *end_;
+};
+
+// Buffered file read stream, as rapidjson::FileReadStream, which can also
+//  capture the source bytes of a value across buffer refills
+class FileStream
+{
+public:
+    typedef char Ch;
+
+    FileStream(std::FILE *file, char *buffer, std::size_t size)
+        : file_{file},
+          buffer_{buffer},
+          size_{size},
+          current_{buffer}
+    {
+        Read();
+    }
+
+    Ch Peek() const
+    {
+        return *current_;
+    }
+
+    Ch Take()
+    {
+        Ch c = *current_;
+        Read();
+        return c;
+    }
+
+    std::size_t Tell() const
+    {
+        return count_ + static_cast<std::size_t>(current_ - buffer_);
+    }
+
+    // Not writable, needed for compilation
+    Ch *PutBegin() { return nullptr; }
+    void Put(Ch) {}
+    void Flush() {}
+    std::size_t PutEnd(Ch *) { return 0; }
+
+    // === Source capture === //
+
+    // Marks where the next event's bytes begin, unless capturing
+    void Mark()
+    {
+        if (!capturing_)
+        {
+            mark_ = current_;
+            spill_.clear();
+        }
+    }
+
+    // Keeps the bytes from the last mark until EndCapture
+    void BeginCapture()
+    {
+        capturing_ = true;
+    }
+
+    // Moves to the bracket closing the value just started, one buffer at a
+    //  time; skipped bytes are never captured
+    void SkipToClose()
+    {
+        CloseScanner scanner;
+
+        if (!capturing_)
+        {
+            mark_ = nullptr;
+        }
+
+        for (;;)
+        {
+            const Ch *stop = scanner.Scan(current_, last_ + 1);
+            if (stop <= last_)
+            {
+                current_ = const_cast<Ch *>(stop);
+                return;
+            }
+
+            // Whole buffer scanned, take its last byte to refill
+            current_ = last_;
+            Read();
+            if (current_ == last_ && eof_)
+            {
+                return;
+            }
+        }
+    }
+
+    void EndCapture(std::string &source)
+    {
+        source.swap(spill_);
+        source.append(mark_, static_cast<const Ch *>(current_));
+        spill_.clear();
+        capturing_ = false;
+    }
+
+private:
+    void Read()
+    {
+        if (current_ < last_)
+        {
+            ++current_;
+            return;
+        }
+
+        if (eof_)
+        {
+            return;
+        }
+
+        // The buffer is about to be overwritten; keep the marked bytes
+        if (mark_)
+        {
+            spill_.append(mark_, static_cast<const Ch *>(last_ + 1));
+            mark_ = buffer_;
+        }
+
+        count_ += read_count_;
+        read_count_ = std::fread(buffer_, 1, size_, file_);
+        last_ = buffer_ + read_count_ - 1;
+        current_ = buffer_;
+
+        if (read_count_ < size_)
+        {
+            buffer_[read_count_] = '\0';
+            ++last_;
+            eof_ = true;
+        }
+    }
+
+    std::FILE *file_;
+    Ch *buffer_;
+    std::size_t size_;
+    Ch *current_;
+    Ch *last_ = nullptr;
+    std::size_t read_count_ = 0;
+    std::size_t count_ = 0;
+    bool eof_ = false;
+
+    const Ch *mark_ = nullptr;
+    bool capturing_ = false;
+    std::string spill_;
+};
+
+// First byte of a value within captured source, which may start with the
+//  whitespace, comments, and separators consumed ahead of the value
+inline const char *SkipToValue(const char *begin, const char *end)
+{
+    while (begin < end)
+    {
+        switch (*begin)
+        {
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+        case ',':
+        case ':':
+            ++begin;
+            continue;
+
+        case '/':
+            if (begin + 1 < end && begin[1] == '*')
+            {
+                const char *close = begin + 2;
+                while (close + 1 < end && !(close[0] == '*' && close[1] == '/'))
+                {
+                    ++close;
+                }
+                begin = close + 2;
+                continue;
+            }
+            while (begin < end && *begin != '\n')
+            {
+                ++begin;
+            }
+            continue;
+
+        default:
+            return begin;
+        }
+    }
+
+    return end;
+}
+
+// Last byte of a value within captured source; a root value is followed by
+//  the whitespace consumed on finishing the document
+inline const char *TrimValueEnd(const char *begin, const char *end)
+{
+    while (end > begin &&
+           (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\n' || end[-1] == '\r'))
+    {
+        --end;
+    }
+
+    return end;
+}
+
+// Removes the comments within captured source, which a config without
+//  kReadComments would reject; strings are kept as they are
+inline void StripComments(std::string &source)
+{
+    std::size_t out = 0;
+    bool is_in_string = false;
+
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        const char c = source[i];
+
+        if (is_in_string)
+        {
+            if (c == '\\' && i + 1 < source.size())
+            {
+                source[out++] = c;
+                source[out++] = source[++i];
+                continue;
+            }
+
+            is_in_string = c != '"';
+        }
+        else if (c == '"')
+        {
+            is_in_string = true;
+        }
+        else if (c == '/' && i + 1 < source.size() && source[i + 1] == '*')
+        {
+            const std::size_t close = source.find("*/", i + 2);
+            i = close == std::string::npos ? source.size() : close + 1;
+            continue;
+        }
+        else if (c == '/' && i + 1 < source.size() && source[i + 1] == '/')
+        {
+            // The newline ending it is kept
+            const std::size_t close = source.find('\n', i + 2);
+            i = close == std::string::npos ? source.size() : close - 1;
+            continue;
+        }
+
+        source[out++] = c;
+    }
+
+    source.resize(out);
+}
+
+// Captures the source bytes of a value, for streams that keep them intact
+template <typename Stream>
+class SourceCapture
+{
+public:
+    constexpr static bool kSupported = false;
+
+    void Mark(Stream &) {}
+    void Begin(Stream &) {}
+    void End(Stream &, std::string &) {}
+};
+
+inline const char *SourceBegin(const rapidjson::StringStream &stream)
+{
+    return stream.head_;
+}
+
+inline const char *SourceBegin(const rapidjson::MemoryStream &stream)
+{
+    return stream.begin_;
+}
+
+// Bytes of the source not yet read; 0 when unknown, as for files and null
+//  terminated strings, whose tail would have to be scanned to measure it
+template <typename Stream>
+std::size_t SourceRemaining(const Stream &)
+{
+    return 0;
+}
+
+inline std::size_t SourceRemaining(const rapidjson::MemoryStream &stream)
+{
+    return static_cast<std::size_t>(stream.end_ - stream.src_);
+}
+
+inline std::size_t SourceRemaining(const InsituStream &stream)
+{
+    return static_cast<std::size_t>(stream.end_ - stream.src_);
+}
+
+// Streams over a whole document in memory are captured by offset
+template <typename Stream>
+class ContiguousCapture
+{
+private:
+    std::size_t mark_ = 0;
+    std::size_t begin_ = 0;
+
+public:
+    constexpr static bool kSupported = true;
+
+    void Mark(Stream &stream)
+    {
+        mark_ = stream.Tell();
+    }
+
+    void Begin(Stream &)
+    {
+        begin_ = mark_;
+    }
+
+    void End(Stream &stream, std::string &source)
+    {
+        const char *begin = SourceBegin(stream) + begin_;
+        const char *end = SourceBegin(stream) + stream.Tell();
+        begin = SkipToValue(begin, end);
+        source.assign(begin, TrimValueEnd(begin, end));
+    }
+};
+
+template <>
+class SourceCapture<rapidjson::StringStream> : public ContiguousCapture<rapidjson::StringStream>
+{
+};
+
+template <>
+class SourceCapture<rapidjson::MemoryStream> : public ContiguousCapture<rapidjson::MemoryStream>
+{
+};
+
+template <>
+class SourceCapture<FileStream>
+{
+public:
+    constexpr static bool kSupported = true;
+
+    void Mark(FileStream &stream)
+    {
+        stream.Mark();
+    }
+
+    void Begin(FileStream &stream)
+    {
+        stream.BeginCapture();
+    }
+
+    void End(FileStream &stream, std::string &source)
+    {
+        stream.EndCapture(source);
+        const char *data = source.data();
+        const char *begin = SkipToValue(data, data + source.size());
+        source.erase(TrimValueEnd(begin, data + source.size()) - data);
+        source.erase(0, begin - data);
+    }
+};
+
+// Skips over values without tokenizing them, for streams with raw access
+template <typename Stream>
+struct StreamSkip
+{
+    constexpr static bool kSupported = false;
+
+    static void SkipToClose(Stream &) {}
+};
+
+// Streams with a current source pointer and, when bounded, an end pointer
+template <typename Stream>
+struct PointerSkip
+{
+    constexpr static bool kSupported = true;
+
+    static void SkipToClose(Stream &stream)
+    {
+        stream.src_ = const_cast<decltype(stream.src_)>(
+            CloseScanner().Scan(stream.src_, End(stream)));
+    }
+
+private:
+    template <typename S>
+    static auto End(S &stream) -> decltype(stream.end_)
+    {
+        return stream.end_;
+    }
+
+    static const char *End(...)
+    {
+        // Null terminated
+        return nullptr;
+    }
+};
+
+template <>
+struct StreamSkip<rapidjson::StringStream> : PointerSkip<rapidjson::StringStream>
+{
+};
+
+template <>
+struct StreamSkip<rapidjson::InsituStringStream> : PointerSkip<rapidjson::InsituStringStream>
+{
+};
+
+template <>
+struct StreamSkip<rapidjson::MemoryStream> : PointerSkip<rapidjson::MemoryStream>
+{
+};
+
+template <>
+struct StreamSkip<InsituStream> : PointerSkip<InsituStream>
+{
+};
+
+template <>
+struct StreamSkip<FileStream>
+{
+    constexpr static bool kSupported = true;
+
+    static void SkipToClose(FileStream &stream)
+    {
+        stream.SkipToClose();
+    }
+};
+
+} // namespace read
+
+} // namespace bound
+
+#endif
\ No newline at end of file
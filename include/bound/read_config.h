@@ -0,0 +1,76 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_READ_CONFIG_H_
+#define BOUND_READ_CONFIG_H_
+
+#ifndef BOUND_READ_MAX_DEPTH
+#define BOUND_READ_MAX_DEPTH 512
+#endif
+
+#include <cstddef>
+#include <rapidjson/reader.h>
+
+namespace bound
+{
+
+// Parse options, combined into a ReadConfig's template argument
+enum ReadFlag : unsigned
+{
+    // Allows /* */ and // comments. Without it, skipped values are tokenized
+    //  rather than scanned, so comments within them are rejected too.
+    kReadComments = rapidjson::kParseCommentsFlag,
+    // Parses doubles exactly, at some cost; otherwise to within a few ulp
+    kReadFullPrecision = rapidjson::kParseFullPrecisionFlag,
+    // Allows NaN, Inf, Infinity, -Inf, and -Infinity as doubles
+    kReadNanAndInf = rapidjson::kParseNanAndInfFlag,
+    // Allows a comma after the last element of an array or object
+    kReadTrailingCommas = rapidjson::kParseTrailingCommasFlag,
+    // Rejects strings that are not valid UTF-8, in skipped values too, which
+    //  are then tokenized rather than scanned
+    kReadValidateEncoding = rapidjson::kParseValidateEncodingFlag,
+    // Ignores whatever follows the root value
+    kReadStopWhenDone = rapidjson::kParseStopWhenDoneFlag,
+    // Stops reading a top-level bound object once each of its properties
+    //  has been set, leaving the rest of the input unread and unvalidated
+    kReadStopWhenFilled = 1u << 24,
+    // Fails objects which repeat a key instead of keeping its last value
+    kReadRejectDuplicateKeys = 1u << 25,
+};
+
+// Flags the reader handles itself rather than passing to rapidjson
+constexpr unsigned kReadReaderFlags = kReadStopWhenFilled | kReadRejectDuplicateKeys;
+
+// Set of rules to determine how JSON is read. The parse flags are template
+//  arguments so rapidjson's parser is specialized for them at compile time,
+//  as ReadConfig<kReadStopWhenDone> for trusted input. Documents nested
+//  deeper than MaxDepth objects and arrays are rejected.
+template <unsigned Flags = kReadComments, std::size_t MaxDepth = BOUND_READ_MAX_DEPTH>
+class ReadConfig
+{
+public:
+    constexpr static unsigned kParseFlags = Flags;
+    constexpr static std::size_t kMaxDepth = MaxDepth;
+};
+
+} // namespace bound
+
+#endif
\ No newline at end of file
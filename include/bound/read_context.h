@@ -0,0 +1,106 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_READ_CONTEXT_H_
+#define BOUND_READ_CONTEXT_H_
+
+#include <memory>
+#include <rapidjson/reader.h>
+#include "read_config.h"
+#include "read/parser.h"
+
+namespace bound
+{
+
+// Parser state kept across documents so its buffers are allocated once. A
+//  context reads one document at a time; a read begun while another is
+//  underway, as from a setter, gets a parser of its own.
+template <typename Config = ReadConfig<>>
+class BasicReadContext
+{
+private:
+    typedef read::Parser<rapidjson::StringStream, Config> Parser;
+
+    Parser parser_{rapidjson::StringStream("")};
+    bool is_in_use_ = false;
+
+public:
+    BasicReadContext() = default;
+    BasicReadContext(const BasicReadContext &) = delete;
+    BasicReadContext &operator=(const BasicReadContext &) = delete;
+    BasicReadContext(const BasicReadContext &&) = delete;
+    BasicReadContext &operator=(const BasicReadContext &&) = delete;
+
+    // The context of reads not given one
+    static BasicReadContext &ThreadLocal()
+    {
+        static thread_local BasicReadContext context;
+        return context;
+    }
+
+    // Lends out the context's parser, started over on json
+    class Lease
+    {
+    private:
+        BasicReadContext *context_ = nullptr;
+        std::unique_ptr<Parser> own_parser_;
+        Parser *parser_;
+
+    public:
+        Lease(BasicReadContext &context, const char *json)
+        {
+            if (context.is_in_use_)
+            {
+                own_parser_.reset(new Parser(rapidjson::StringStream(json)));
+                parser_ = own_parser_.get();
+                return;
+            }
+
+            context_ = &context;
+            context_->is_in_use_ = true;
+            parser_ = &context_->parser_;
+            parser_->Reset(rapidjson::StringStream(json));
+        }
+        Lease(const Lease &) = delete;
+        Lease &operator=(const Lease &) = delete;
+        Lease(const Lease &&) = delete;
+        Lease &operator=(const Lease &&) = delete;
+
+        ~Lease()
+        {
+            if (context_ != nullptr)
+            {
+                context_->is_in_use_ = false;
+            }
+        }
+
+        Parser &parser()
+        {
+            return *parser_;
+        }
+    };
+};
+
+typedef BasicReadContext<> ReadContext;
+
+} // namespace bound
+
+#endif
\ No newline at end of file
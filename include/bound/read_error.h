@@ -0,0 +1,62 @@
+/*
+Copyright 2019 Chad Hartman
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of 
+this software and associated documentation files (the "Software"), to deal in the 
+Software without restriction, including without limitation the rights to use, copy, 
+modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, 
+and to permit persons to whom the Software is furnished to do so, subject to the 
+following conditions:
+
+The above copyright notice and this permission notice shall be included in all 
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A 
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT 
+HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION 
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+
+#ifndef BOUND_READ_ERROR_H_
+#define BOUND_READ_ERROR_H_
+
+namespace bound
+{
+
+// Why a read failed
+enum class ReadError
+{
+    kNone,
+    // The document is not valid JSON
+    kParse,
+    // Objects and arrays nest deeper than the ReadConfig allows
+    kTooDeep,
+    // An object's value has no key
+    kMissingKey,
+    // An object's key is followed by another key
+    kUnassignedKey,
+    // An event that can't start or continue the value being read
+    kUnexpectedEvent,
+    // A value of a type its property can't be assigned from
+    kCannotAssign,
+    // A number outside the range of its property's type
+    kOutOfRange,
+    // The document is not the array being read
+    kExpectedArray,
+    // The file could not be opened
+    kFileOpen,
+    // The document has no value at the JSON Pointer
+    kNotFound,
+    // The JSON Pointer is malformed
+    kInvalidPointer,
+    // An object lacks a required property
+    kMissingProperty,
+    // An object repeats a key, with kReadRejectDuplicateKeys
+    kDuplicateKey
+};
+
+} // namespace bound
+
+#endif
\ No newline at end of file
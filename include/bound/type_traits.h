@@ -26,6 +26,8 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <vector>
 #include <list>
 #include <deque>
+#include <map>
+#include <string>
 
 namespace bound
 {
@@ -46,19 +48,36 @@ public:
     constexpr static bool value = sizeof(test<T>(0)) == sizeof(char);
 };
 
-// Detects whether anything is a deque, list, or vector
+// Detects whether anything is a deque, list, or vector, with any allocator
 template <typename T>
 struct is_seq_container : std::false_type
 {
 };
 
-template <template <typename...> class Container, typename T>
-struct is_seq_container<Container<T>>
+template <typename T, typename Alloc>
+struct is_seq_container<std::vector<T, Alloc>> : std::true_type
+{
+};
+
+template <typename T, typename Alloc>
+struct is_seq_container<std::deque<T, Alloc>> : std::true_type
+{
+};
+
+template <typename T, typename Alloc>
+struct is_seq_container<std::list<T, Alloc>> : std::true_type
+{
+};
+
+// Detects a string of char with any allocator
+template <typename T>
+struct is_string : std::false_type
+{
+};
+
+template <typename Alloc>
+struct is_string<std::basic_string<char, std::char_traits<char>, Alloc>> : std::true_type
 {
-    constexpr static bool value =
-        std::is_same<Container<T>, std::vector<T>>::value ||
-        std::is_same<Container<T>, std::deque<T>>::value ||
-        std::is_same<Container<T>, std::list<T>>::value;
 };
 
 template <typename T>
@@ -66,8 +85,8 @@ struct is_json_properties : std::false_type
 {
 };
 
-template <typename V>
-struct is_json_properties<std::map<std::string, V>> : std::true_type
+template <typename K, typename V, typename Compare, typename Alloc>
+struct is_json_properties<std::map<K, V, Compare, Alloc>> : is_string<K>
 {
 };
 
@@ -117,14 +136,24 @@ struct is_setter<void (Class::*)(T)> : std::true_type
     const static bool arg_is_pointer = std::is_pointer<T>::value;
 };
 
+template <typename T>
+struct is_reservable : std::false_type
+{
+};
+
+template <typename T, typename Alloc>
+struct is_reservable<std::vector<T, Alloc>> : std::true_type
+{
+};
+
 template <typename T>
 struct is_clearable
 {
     const static bool value = is_seq_container<T>::value;
 };
 
-template <typename K, typename V>
-struct is_clearable<std::map<K, V>> : std::true_type
+template <typename K, typename V, typename Compare, typename Alloc>
+struct is_clearable<std::map<K, V, Compare, Alloc>> : std::true_type
 {
 };
 
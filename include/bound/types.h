@@ -27,6 +27,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <string>
 #include <map>
 #include <iostream>
+#include <type_traits>
 
 namespace bound
 {
@@ -157,6 +158,87 @@ inline std::ostream &operator<<(std::ostream &os, const JsonRaw &value)
     return os;
 }
 
+// Keeps the source of a value and parses it into T on first access, with
+//  the config it was read with; the parsed value is cached. Get is defined
+//  with the reader in read/reader.h.
+template <typename T>
+class JsonLazy
+{
+public:
+    // Parses source into value, returning the error message
+    typedef std::string (*Parse)(const std::string &source, T &value);
+
+private:
+    std::string source_;
+    Parse parse_ = nullptr;
+    mutable T value_{};
+    mutable bool parsed_ = true;
+    mutable std::string error_message_;
+
+public:
+    using type = T;
+
+    bool render = true;
+
+    JsonLazy &operator=(const T &new_val)
+    {
+        value_ = new_val;
+        source_.clear();
+        parsed_ = true;
+        error_message_.clear();
+        return *this;
+    }
+
+    // Replaces the value with unparsed json, to be parsed by parse; by
+    //  read::FromJson with the default config when null
+    void SetSource(std::string &&source, Parse parse = nullptr)
+    {
+        source_ = std::move(source);
+        parse_ = parse;
+        value_ = T();
+        parsed_ = false;
+        error_message_.clear();
+    }
+
+    // The json the value was read from; empty when assigned directly
+    const std::string &source() const
+    {
+        return source_;
+    }
+
+    // Whether the value no longer needs parsing
+    bool parsed() const
+    {
+        return parsed_;
+    }
+
+    // Error from parsing the source, empty on success
+    const std::string &error_message() const
+    {
+        return error_message_;
+    }
+
+    // Parses the source on first access. Not thread safe, const or not: the
+    //  first call fills the cache, so a value shared between threads must be
+    //  parsed before they read it.
+    const T &Get() const;
+
+    T &Get()
+    {
+        return const_cast<T &>(static_cast<const JsonLazy &>(*this).Get());
+    }
+};
+
+template <typename T>
+struct is_json_lazy : std::false_type
+{
+};
+
+template <typename T>
+struct is_json_lazy<JsonLazy<T>> : std::true_type
+{
+};
+
 } // namespace bound
 
 #endif
\ No newline at end of file
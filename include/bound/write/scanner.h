@@ -65,7 +65,8 @@ public:
     }
 
     template <typename T>
-    unsigned Scan(std::map<std::string, T> &map)
+    typename std::enable_if<is_json_properties<T>::value, unsigned>::type
+    Scan(T &map)
     {
         unsigned count = 0;
         for (auto &i : map)
@@ -118,7 +119,7 @@ public:
     template <typename T>
     typename std::enable_if<
         std::is_same<T, bool>::value ||
-            std::is_same<T, std::string>::value ||
+            is_string<T>::value ||
             is_int<T>::value ||
             is_uint<T>::value ||
             std::is_floating_point<T>::value,
@@ -137,6 +138,16 @@ public:
         return value.value.length() == 0 ? 0 : 1;
     }
 
+    template <typename T>
+    unsigned Scan(JsonLazy<T> &value)
+    {
+        if (!value.render)
+        {
+            return 0;
+        }
+        return value.parsed() ? Scan(value.Get()) : 1;
+    }
+
     unsigned Scan(const JsonString &value)
     {
         return value.render ? Scan(value.value) : 0;
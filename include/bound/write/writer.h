@@ -57,7 +57,8 @@ class Writer
     Scanner scanner_;
 
     template <typename T>
-    void WriteMapContents(std::map<std::string, T> &object)
+    typename std::enable_if_t<is_json_properties<T>::value>
+    WriteMapContents(T &object)
     {
         for (auto &i : object)
         {
@@ -65,13 +66,14 @@ class Writer
             {
                 continue;
             }
-            writer_.Key(i.first.c_str());
+            writer_.Key(i.first.data(), static_cast<rapidjson::SizeType>(i.first.size()));
             Write(i.second);
         }
     }
 
     template <typename T>
-    void WriteMapContents(T &object)
+    typename std::enable_if_t<!is_json_properties<T>::value>
+    WriteMapContents(T &object)
     {
         // Exists only for compilation
     }
@@ -113,7 +115,8 @@ public:
     }
 
     template <typename T>
-    void Write(std::map<std::string, T> &map)
+    typename std::enable_if_t<is_json_properties<T>::value>
+    Write(T &map)
     {
         writer_.StartObject();
         WriteMapContents(map);
@@ -179,9 +182,10 @@ public:
         writer_.Double(value);
     }
 
-    void Write(const std::string &value)
+    template <typename Alloc>
+    void Write(const std::basic_string<char, std::char_traits<char>, Alloc> &value)
     {
-        writer_.String(value.c_str());
+        writer_.String(value.data(), static_cast<rapidjson::SizeType>(value.size()));
     }
 
     void Write(const JsonRaw value)
@@ -192,6 +196,22 @@ public:
             rapidjson::kStringType);
     }
 
+    // Unparsed values are written as they were read
+    template <typename T>
+    void Write(JsonLazy<T> &value)
+    {
+        if (value.parsed())
+        {
+            Write(value.Get());
+            return;
+        }
+
+        writer_.RawValue(
+            value.source().c_str(),
+            value.source().length(),
+            rapidjson::kStringType);
+    }
+
     void Write(const JsonString value)
     {
         Write(value.value);
@@ -225,6 +245,49 @@ inline void Write(Stream &writer, T &instance, const WriteConfig &write_config)
     Writer<decltype(writer)>(writer, write_config).Write(instance);
 }
 
+// Writes each record as a compact document on its own line, as JSON Lines,
+//  reusing one writer for every record
+template <typename Stream, typename T>
+void WriteLines(Stream &os, T &records, const WriteConfig &write_config)
+{
+    rapidjson::Writer<Stream> writer(os);
+    writer.SetMaxDecimalPlaces(write_config.GetMaxDecimalPlaces());
+    Writer<decltype(writer)> record_writer(writer, write_config);
+
+    for (auto &record : records)
+    {
+        record_writer.Write(record);
+        os.Put('\n');
+        writer.Reset(os);
+    }
+}
+
+template <typename T>
+const std::string ToJsonLines(T &records, const WriteConfig &write_config)
+{
+    rapidjson::StringBuffer buffer;
+    WriteLines(buffer, records, write_config);
+    return buffer.GetString();
+}
+
+template <typename T>
+bool ToJsonLinesFile(T &records, const WriteConfig &write_config)
+{
+    FILE *fp = fopen(write_config.GetFilename().c_str(), BOUND_BOUND_H_WRITE_MODE);
+    if (!fp)
+    {
+        return false;
+    }
+
+    char buffer[BOUND_FILE_WRITE_BUFFER_SIZE];
+    rapidjson::FileWriteStream os(fp, buffer, sizeof(buffer));
+    WriteLines(os, records, write_config);
+    os.Flush();
+
+    fclose(fp);
+    return true;
+}
+
 template <typename T>
 const std::string ToJson(T &instance, const WriteConfig &write_config)
 {
@@ -114,9 +114,11 @@ public:
                fabs(value - float_filter_.value) < std::numeric_limits<T>::epsilon();
     }
 
-    bool IsFiltered(const std::string &value) const
+    template <typename Alloc>
+    bool IsFiltered(const std::basic_string<char, std::char_traits<char>, Alloc> &value) const
     {
-        return string_filter_.enabled && string_filter_.value == value;
+        return string_filter_.enabled &&
+               string_filter_.value.compare(0, std::string::npos, value.data(), value.size()) == 0;
     }
 
     bool HasPrefix() const
@@ -37,7 +37,7 @@ int main()
     }
     else
     {
-        printf("Failed to create: \"%s\"\n", status.error_message.c_str());
+        printf("Failed to create: \"%s\"\n", status.error_message().c_str());
     }
 
     assert(foo.bar.value == "bar_value");
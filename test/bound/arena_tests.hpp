@@ -0,0 +1,120 @@
+#ifndef BOUND_ARENA_TESTS_HPP_
+#define BOUND_ARENA_TESTS_HPP_
+
+#include "tests.h"
+
+namespace bound_arena_tests_hpp_
+{
+
+struct Item
+{
+    bound::ArenaString name;
+    bound::ArenaVector<int> values;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Item::name, "name"),
+        bound::property(&Item::values, "values"));
+};
+
+struct Request
+{
+    int id;
+    bound::ArenaString user;
+    bound::ArenaVector<Item> items;
+    std::list<bound::ArenaString, bound::ArenaAllocator<bound::ArenaString>> tags;
+    bound::ArenaMap<bound::ArenaString> extra;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Request::id, "id"),
+        bound::property(&Request::user, "user"),
+        bound::property(&Request::items, "items"),
+        bound::property(&Request::tags, "tags"),
+        bound::property(&Request::extra));
+};
+
+const char *kJson =
+    "{\"id\":7,\"user\":\"a user name too long for the small string buffer\","
+    "\"items\":[{\"name\":\"first\",\"values\":[1,2,3]},{\"name\":\"second\",\"values\":[]}],"
+    "\"tags\":[\"x\",\"y\"],\"zeta\":\"z\",\"alpha\":\"a\"}";
+
+TEST_CASE("Arena Tests", "[arena_tests]")
+{
+    SECTION("Allocations are aligned and grow into new blocks")
+    {
+        bound::Arena arena{64};
+        char *byte = static_cast<char *>(arena.Allocate(1, 1));
+        double *number = static_cast<double *>(arena.Allocate(sizeof(double), alignof(double)));
+        REQUIRE(byte != nullptr);
+        REQUIRE(0 == reinterpret_cast<std::uintptr_t>(number) % alignof(double));
+
+        void *large = arena.Allocate(1000, 8);
+        REQUIRE(large != nullptr);
+        REQUIRE(1000 <= arena.capacity());
+
+        // Reset keeps only the newest block
+        arena.Reset();
+        const std::size_t capacity = arena.capacity();
+        REQUIRE(1000 <= capacity);
+        REQUIRE(large == arena.Allocate(1000, 8));
+        REQUIRE(capacity == arena.capacity());
+    }
+
+    SECTION("Scopes set the arena of default constructed allocators")
+    {
+        REQUIRE(nullptr == bound::Arena::Current());
+        REQUIRE(nullptr == bound::ArenaAllocator<int>().arena());
+
+        bound::Arena outer;
+        bound::Arena inner;
+        {
+            bound::ArenaScope outer_scope{outer};
+            {
+                bound::ArenaScope inner_scope{inner};
+                REQUIRE(&inner == bound::ArenaAllocator<int>().arena());
+            }
+            REQUIRE(&outer == bound::ArenaAllocator<int>().arena());
+        }
+        REQUIRE(nullptr == bound::Arena::Current());
+    }
+
+    SECTION("Object graphs are read into and written from the arena")
+    {
+        bound::Arena arena;
+        {
+            bound::ArenaScope scope{arena};
+            auto status = bound::CreateWithJson<Request>(kJson);
+            REQUIRE(status.success);
+
+            Request &request = status.instance;
+            REQUIRE(7 == request.id);
+            REQUIRE(&arena == request.user.get_allocator().arena());
+            REQUIRE("a user name too long for the small string buffer" == std::string(request.user.c_str()));
+            REQUIRE(2 == request.items.size());
+            REQUIRE(&arena == request.items.get_allocator().arena());
+            REQUIRE(&arena == request.items[0].values.get_allocator().arena());
+            REQUIRE((std::vector<int>{1, 2, 3}) == std::vector<int>(request.items[0].values.begin(), request.items[0].values.end()));
+            REQUIRE(2 == request.tags.size());
+            REQUIRE(2 == request.extra.size());
+            REQUIRE("a" == std::string(request.extra.begin()->second.c_str()));
+            REQUIRE(0 < arena.capacity());
+
+            REQUIRE(
+                "{\"id\":7,\"user\":\"a user name too long for the small string buffer\","
+                "\"items\":[{\"name\":\"first\",\"values\":[1,2,3]},{\"name\":\"second\",\"values\":[]}],"
+                "\"tags\":[\"x\",\"y\"],\"alpha\":\"a\",\"zeta\":\"z\"}" == bound::ToJson(request));
+        }
+        arena.Reset();
+    }
+
+    SECTION("Outside of a scope the heap is used")
+    {
+        auto status = bound::CreateWithJson<Request>(kJson);
+        REQUIRE(status.success);
+        REQUIRE(nullptr == status.instance.user.get_allocator().arena());
+        REQUIRE(2 == status.instance.items.size());
+    }
+}
+
+} // namespace bound_arena_tests_hpp_
+
+#endif
\ No newline at end of file
@@ -2,7 +2,9 @@
 #define TEST_INCLUDE_BOUND_TESTS_H_
 
 #include <fstream>
+#include <memory>
 #include <sstream>
+#include <vector>
 
 namespace test_include_bound_tests_h_
 {
@@ -23,6 +25,45 @@ struct Foo
         bound::property(&Foo::value, "value"));
 };
 
+struct Named
+{
+    std::string name;
+    int value;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Named::name, "name"),
+        bound::property(&Named::value, "value"));
+};
+
+// Can't be copied, so CreateWithJson must build it in place
+struct MoveOnly
+{
+    int value;
+    std::unique_ptr<int> pointer;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&MoveOnly::value, "value"));
+};
+
+// Reads nested json from its setter while the outer read is underway
+struct Nested
+{
+    int value;
+
+    void set_json(std::string json)
+    {
+        value = bound::CreateWithJson<Foo>(json).instance.value;
+    }
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Nested::set_json, "json"));
+};
+
+std::vector<char> Buffer(const std::string &json)
+{
+    return std::vector<char>(json.begin(), json.end());
+}
+
 TEST_CASE("CreateWithJson", "[create_with_json]")
 {
     SECTION("CreateStatus<T> CreateWithJson(const std::string &json)")
@@ -30,7 +71,7 @@ TEST_CASE("CreateWithJson", "[create_with_json]")
         const std::string json = "{\"value\":17}";
         auto status = bound::CreateWithJson<Foo>(json);
         REQUIRE(status.success);
-        REQUIRE(0 == status.error_message.length());
+        REQUIRE(0 == status.error_message().length());
         REQUIRE(17 == status.instance.value);
         // Demonstate it's mutable
         status.instance.value = 18;
@@ -40,17 +81,194 @@ TEST_CASE("CreateWithJson", "[create_with_json]")
     {
         auto status = bound::CreateWithJson<Foo>("{\"value\":17}");
         REQUIRE(status.success);
-        REQUIRE(0 == status.error_message.length());
+        REQUIRE(0 == status.error_message().length());
         REQUIRE(17 == status.instance.value);
         // Demonstate it's mutable
         status.instance.value = 18;
     }
 
+    SECTION("CreateStatus<T> CreateWithJson(const char *json)")
+    {
+        const char *json = "{\"value\":17}";
+        auto status = bound::CreateWithJson<Foo>(json);
+        REQUIRE(status.success);
+        REQUIRE(17 == status.instance.value);
+    }
+
     SECTION("CreateWithJson invalid json")
     {
-        auto status = bound::CreateWithJson<Foo>("{\"value\":}");
+        const char *json = "{\"value\":}";
+        auto status = bound::CreateWithJson<Foo>(json);
+        REQUIRE(!status.success);
+        REQUIRE(0 < status.error_message().length());
+        REQUIRE(bound::ReadError::kParse == status.error);
+        REQUIRE(1 == status.position(json).line);
+        REQUIRE(status.offset + 1 == status.position(json).column);
+    }
+
+    SECTION("CreateStatus<T> CreateWithJson(ReadContext &context, const char *json)")
+    {
+        bound::ReadContext context;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            auto status = bound::CreateWithJson<Named>(context, "{\"name\":\"first\",\"value\":1}");
+            REQUIRE(status.success);
+            REQUIRE("first" == status.instance.name);
+
+            // An error leaves nothing behind for the next document
+            auto invalid = bound::CreateWithJson<Named>(context, "{\"name\":\"second\",\"value\":");
+            REQUIRE(!invalid.success);
+        }
+
+        auto map = bound::CreateWithJson<std::map<std::string, int>>(context, std::string("{\"a\":1,\"b\":2}"));
+        REQUIRE(map.success);
+        REQUIRE(2 == map.instance.at("b"));
+    }
+
+    SECTION("CreateWithJson reuses a context after documents left short")
+    {
+        bound::BasicReadContext<bound::ReadConfig<bound::kReadComments | bound::kReadStopWhenFilled, 3>> context;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            REQUIRE(!bound::CreateWithJson<Foo>(context, "{\"value\":[1,").success);
+            REQUIRE(!bound::CreateWithJson<Foo>(context, "{\"value\":[[[[1]]]]}").success);
+
+            // Stopping once filled leaves the rest of the document unparsed
+            auto filled = bound::CreateWithJson<Foo>(context, "{\"value\":1,\"rest\":[[");
+            REQUIRE(filled.success);
+            REQUIRE(1 == filled.instance.value);
+
+            auto status = bound::CreateWithJson<Foo>(context, "{\"value\":17}");
+            REQUIRE(status.success);
+            REQUIRE(17 == status.instance.value);
+        }
+    }
+
+    SECTION("CreateStatus<T> CreateWithJson(const char *json, const ReadConfig<Flags> &config)")
+    {
+        const char *commented = "{/* seventeen */\"value\":17}";
+        REQUIRE(bound::CreateWithJson<Foo>(commented).success);
+        REQUIRE(!bound::CreateWithJson<Foo>(commented, bound::ReadConfig<0>()).success);
+
+        const std::string trailing = "{\"value\":17} trailing";
+        REQUIRE(!bound::CreateWithJson<Foo>(trailing).success);
+        auto status = bound::CreateWithJson<Foo>(trailing, bound::ReadConfig<bound::kReadStopWhenDone>());
+        REQUIRE(status.success);
+        REQUIRE(17 == status.instance.value);
+
+        bound::BasicReadContext<bound::ReadConfig<bound::kReadStopWhenDone>> context;
+        REQUIRE(bound::CreateWithJson<Foo>(context, trailing).success);
+
+        std::vector<char> buffer = Buffer(trailing);
+        REQUIRE(bound::CreateWithJsonInsitu<Foo>(
+                    buffer.data(), buffer.size(), bound::ReadConfig<bound::kReadStopWhenDone>())
+                    .success);
+    }
+
+    SECTION("CreateManyStatus CreateManyWithJson(const std::vector<Document> &documents, std::vector<T> &instances)")
+    {
+        const std::vector<std::string> documents = {
+            "{\"name\":\"a\",\"value\":1}",
+            "{\"name\":\"b\",\"value\":}",
+            "{\"name\":\"c\",\"value\":3}",
+            "{\"value\":\"d\"}"};
+        std::vector<Named> named(10);
+
+        auto status = bound::CreateManyWithJson(documents, named);
+        REQUIRE(!status.success);
+        REQUIRE(4 == named.size());
+        REQUIRE("a" == named[0].name);
+        REQUIRE("c" == named[2].name);
+        REQUIRE(3 == named[2].value);
+
+        const std::vector<bound::ReadError> errors = {
+            bound::ReadError::kNone,
+            bound::ReadError::kParse,
+            bound::ReadError::kNone,
+            bound::ReadError::kCannotAssign};
+        REQUIRE(errors == status.errors);
+        REQUIRE(4 == status.offsets.size());
+        REQUIRE(documents[1].find('}') == status.offsets[1]);
+
+        // The status is the first failure's
+        REQUIRE(bound::ReadError::kParse == status.error);
+        REQUIRE(bound::read::ReadStatus::kDocument == status.part);
+        REQUIRE(1 == status.part_index);
+        REQUIRE(0 == status.error_message().find("Document 1: "));
+
+        const std::vector<const char *> literals = {"{\"value\":1}", "{\"value\":2}"};
+        std::vector<Foo> foos;
+        auto literal_status = bound::CreateManyWithJson<Foo>(literals, foos);
+        REQUIRE(literal_status.success);
+        REQUIRE(2 == foos[1].value);
+
+        bound::ReadContext context;
+        REQUIRE(bound::CreateManyWithJson(context, std::vector<std::string>(), foos).success);
+        REQUIRE(foos.empty());
+    }
+
+    SECTION("CreateWithJson nested in a read")
+    {
+        bound::ReadContext context;
+        auto status = bound::CreateWithJson<Nested>(context, "{\"json\":\"{\\\"value\\\":5}\"}");
+        REQUIRE(status.success);
+        REQUIRE(5 == status.instance.value);
+
+        // The implicit context is in use by the outer read as well
+        REQUIRE(5 == bound::CreateWithJson<Nested>("{\"json\":\"{\\\"value\\\":5}\"}").instance.value);
+    }
+
+    SECTION("CreateWithJson move only type")
+    {
+        auto status = bound::CreateWithJson<MoveOnly>("{\"value\":17}");
+        REQUIRE(status.success);
+        REQUIRE(17 == status.instance.value);
+
+        // The status moves with its instance
+        auto moved = std::move(status);
+        REQUIRE(17 == moved.instance.value);
+        REQUIRE(moved.success);
+    }
+}
+
+TEST_CASE("CreateWithJsonInsitu", "[create_with_json_insitu]")
+{
+    SECTION("CreateStatus<T> CreateWithJsonInsitu(char *json, size_t length)")
+    {
+        auto buffer = Buffer("{\"name\":\"a\\tb\",\"value\":17}");
+        auto status = bound::CreateWithJsonInsitu<Named>(
+            buffer.data(), buffer.size());
+        REQUIRE(status.success);
+        REQUIRE(0 == status.error_message().length());
+        REQUIRE("a\tb" == status.instance.name);
+        REQUIRE(17 == status.instance.value);
+    }
+
+    SECTION("CreateWithJsonInsitu reads only length bytes")
+    {
+        auto buffer = Buffer("{\"value\":17}{\"value\":");
+        auto status = bound::CreateWithJsonInsitu<Foo>(buffer.data(), 12);
+        REQUIRE(status.success);
+        REQUIRE(17 == status.instance.value);
+    }
+
+    SECTION("CreateWithJsonInsitu invalid json")
+    {
+        auto buffer = Buffer("{\"value\":}");
+        auto status = bound::CreateWithJsonInsitu<Foo>(
+            buffer.data(), buffer.size());
+        REQUIRE(!status.success);
+        REQUIRE(0 < status.error_message().length());
+    }
+
+    SECTION("CreateWithJsonInsitu truncated json")
+    {
+        auto buffer = Buffer("{\"name\":\"abc\"}");
+        auto status = bound::CreateWithJsonInsitu<Named>(buffer.data(), 11);
         REQUIRE(!status.success);
-        REQUIRE(0 < status.error_message.length());
+        REQUIRE(0 < status.error_message().length());
     }
 }
 
@@ -66,7 +284,7 @@ TEST_CASE("CreateWithJsonFile", "[create_with_json_file]")
 
         auto status = bound::CreateWithJsonFile<Foo>(path);
         REQUIRE(status.success);
-        REQUIRE(0 == status.error_message.length());
+        REQUIRE(0 == status.error_message().length());
         REQUIRE(22 == status.instance.value);
         // Demonstate it's mutable
         status.instance.value = 18;
@@ -80,7 +298,7 @@ TEST_CASE("CreateWithJsonFile", "[create_with_json_file]")
 
         auto status = bound::CreateWithJsonFile<Foo>("test_temp.json");
         REQUIRE(status.success);
-        REQUIRE(0 == status.error_message.length());
+        REQUIRE(0 == status.error_message().length());
         REQUIRE(23 == status.instance.value);
         // Demonstate it's mutable
         status.instance.value = 18;
@@ -90,7 +308,44 @@ TEST_CASE("CreateWithJsonFile", "[create_with_json_file]")
     {
         auto status = bound::CreateWithJsonFile<Foo>("malformed.json");
         REQUIRE(!status.success);
-        REQUIRE(0 < status.error_message.length());
+        REQUIRE(0 < status.error_message().length());
+    }
+
+    SECTION("CreateWithJsonFile mapped")
+    {
+        const Foo foo_original = {24};
+        bound::ToJsonFile(foo_original, path);
+
+        for (auto mode : {bound::FileReadMode::kMapped, bound::FileReadMode::kMappedHugePages})
+        {
+            auto status = bound::CreateWithJsonFile<Foo>(path, mode);
+            REQUIRE(status.success);
+            REQUIRE(0 == status.error_message().length());
+            REQUIRE(24 == status.instance.value);
+        }
+    }
+
+    SECTION("CreateWithJsonFile mapped invalid json")
+    {
+        auto status = bound::CreateWithJsonFile<Foo>("malformed.json", bound::FileReadMode::kMapped);
+        REQUIRE(!status.success);
+        REQUIRE(0 < status.error_message().length());
+    }
+
+    SECTION("CreateWithJsonFile mapped missing file")
+    {
+        auto status = bound::CreateWithJsonFile<Foo>("missing.json", bound::FileReadMode::kMapped);
+        REQUIRE(!status.success);
+        REQUIRE("Unable to open file \"missing.json\"." == status.error_message());
+    }
+
+    SECTION("CreateWithJsonFile mapped empty file")
+    {
+        std::ofstream{path, std::ios::trunc};
+
+        auto status = bound::CreateWithJsonFile<Foo>(path, bound::FileReadMode::kMapped);
+        REQUIRE(!status.success);
+        REQUIRE(0 < status.error_message().length());
     }
 }
 
@@ -103,7 +358,7 @@ TEST_CASE("UpdateWithJson", "[update_with_json]")
         const std::string json = "{\"value\":17}";
         auto status = bound::UpdateWithJson(foo, json);
         REQUIRE(status.success);
-        REQUIRE(0 == status.error_message.length());
+        REQUIRE(0 == status.error_message().length());
         REQUIRE(17 == foo.value);
     }
 
@@ -111,15 +366,71 @@ TEST_CASE("UpdateWithJson", "[update_with_json]")
     {
         auto status = bound::UpdateWithJson(foo, "{\"value\":18}");
         REQUIRE(status.success);
-        REQUIRE(0 == status.error_message.length());
+        REQUIRE(0 == status.error_message().length());
         REQUIRE(18 == foo.value);
     }
 
+    SECTION("UpdateStatus UpdateWithJson(T &instance, const char *json)")
+    {
+        const char *json = "{\"value\":19}";
+        auto status = bound::UpdateWithJson(foo, json);
+        REQUIRE(status.success);
+        REQUIRE(19 == foo.value);
+    }
+
+    SECTION("UpdateStatus UpdateWithJson(ReadContext &context, T &instance, const char *json)")
+    {
+        bound::ReadContext context;
+        REQUIRE(bound::UpdateWithJson(context, foo, "{\"value\":20}").success);
+        REQUIRE(20 == foo.value);
+        REQUIRE(bound::UpdateWithJson(context, foo, std::string("{\"value\":21}")).success);
+        REQUIRE(21 == foo.value);
+    }
+
+    SECTION("UpdateStatus UpdateWithJson(T &instance, const char *json, const FieldMask<T> &fields)")
+    {
+        Named named{"kept", 1};
+        auto status = bound::UpdateWithJson(named, "{\"name\":\"replaced\",\"value\":22}", {"value"});
+        REQUIRE(status.success);
+        REQUIRE("kept" == named.name);
+        REQUIRE(22 == named.value);
+
+        const std::string json = "{\"name\":\"replaced\",\"value\":23}";
+        REQUIRE(bound::UpdateWithJson(named, json, bound::FieldMask<Named>{"name"}).success);
+        REQUIRE("replaced" == named.name);
+        REQUIRE(22 == named.value);
+    }
+
     SECTION("UpdateWithJson invalid json")
     {
         auto status = bound::UpdateWithJson(foo, "{\"value\":}");
         REQUIRE(!status.success);
-        REQUIRE(0 < status.error_message.length());
+        REQUIRE(0 < status.error_message().length());
+    }
+}
+
+TEST_CASE("UpdateWithJsonInsitu", "[update_with_json_insitu]")
+{
+    Named named = {"before", 3};
+
+    SECTION("UpdateStatus UpdateWithJsonInsitu(T &instance, char *json, size_t length)")
+    {
+        auto buffer = Buffer("{\"name\":\"\\u00e9t\\u00e9\"}");
+        auto status = bound::UpdateWithJsonInsitu(
+            named, buffer.data(), buffer.size());
+        REQUIRE(status.success);
+        REQUIRE(0 == status.error_message().length());
+        REQUIRE("\xC3\xA9t\xC3\xA9" == named.name);
+        REQUIRE(3 == named.value);
+    }
+
+    SECTION("UpdateWithJsonInsitu invalid json")
+    {
+        auto buffer = Buffer("{\"value\":}");
+        auto status = bound::UpdateWithJsonInsitu(
+            named, buffer.data(), buffer.size());
+        REQUIRE(!status.success);
+        REQUIRE(0 < status.error_message().length());
     }
 }
 
@@ -135,7 +446,7 @@ TEST_CASE("UpdateWithJsonFile", "[update_with_json_file]")
 
         auto status = bound::UpdateWithJsonFile(foo_mutable, path);
         REQUIRE(status.success);
-        REQUIRE(0 == status.error_message.length());
+        REQUIRE(0 == status.error_message().length());
         REQUIRE(32 == foo_mutable.value);
     }
 
@@ -146,7 +457,7 @@ TEST_CASE("UpdateWithJsonFile", "[update_with_json_file]")
 
         auto status = bound::UpdateWithJsonFile(foo_mutable, "test_temp.json");
         REQUIRE(status.success);
-        REQUIRE(0 == status.error_message.length());
+        REQUIRE(0 == status.error_message().length());
         REQUIRE(33 == foo_mutable.value);
     }
 
@@ -154,7 +465,79 @@ TEST_CASE("UpdateWithJsonFile", "[update_with_json_file]")
     {
         auto status = bound::UpdateWithJsonFile(foo_mutable, "malformed.json");
         REQUIRE(!status.success);
-        REQUIRE(0 < status.error_message.length());
+        REQUIRE(0 < status.error_message().length());
+    }
+
+    SECTION("UpdateWithJsonFile mapped")
+    {
+        const Foo foo_original = {34};
+        bound::ToJsonFile(foo_original, path);
+
+        auto status = bound::UpdateWithJsonFile(foo_mutable, path, bound::FileReadMode::kMapped);
+        REQUIRE(status.success);
+        REQUIRE(0 == status.error_message().length());
+        REQUIRE(34 == foo_mutable.value);
+    }
+}
+
+TEST_CASE("ForEachInJsonArray", "[for_each_in_json_array]")
+{
+    const std::string json = "[{\"name\":\"a\",\"value\":1},{\"name\":\"b\",\"value\":2},{\"value\":3}]";
+
+    SECTION("UpdateStatus ForEachInJsonArray(const std::string &json, F &&callback)")
+    {
+        std::vector<Named> seen;
+        const Named *instance = nullptr;
+
+        auto status = bound::ForEachInJsonArray<Named>(json, [&](Named &named) {
+            // The same instance is read into for every element
+            REQUIRE((instance == nullptr || instance == &named));
+            instance = &named;
+            seen.push_back(named);
+        });
+        REQUIRE(status.success);
+        REQUIRE(0 == status.error_message().length());
+        REQUIRE(3 == seen.size());
+        REQUIRE("a" == seen[0].name);
+        REQUIRE(2 == seen[1].value);
+        // Missing properties keep the previous element's value
+        REQUIRE("b" == seen[2].name);
+        REQUIRE(3 == seen[2].value);
+    }
+
+    SECTION("UpdateStatus ForEachInJsonArrayFile(const std::string &path, F &&callback)")
+    {
+        const std::string path = "test_temp.json";
+        std::ofstream{path, std::ios::trunc} << json;
+
+        for (auto mode : {bound::FileReadMode::kStream, bound::FileReadMode::kMapped})
+        {
+            int sum = 0;
+            auto status = bound::ForEachInJsonArrayFile<Named>(
+                path, [&](const Named &named) { sum += named.value; }, mode);
+            REQUIRE(status.success);
+            REQUIRE(6 == sum);
+        }
+    }
+
+    SECTION("ForEachInJsonArray stops at the first error")
+    {
+        int count = 0;
+        auto status = bound::ForEachInJsonArray<Foo>("[{\"value\":1},{\"value\":\"x\"},{\"value\":3}]",
+                                                     [&](Foo &) { ++count; });
+        REQUIRE(!status.success);
+        REQUIRE(1 == count);
+
+        auto truncated = bound::ForEachInJsonArray<Foo>("[{\"value\":1},", [&](Foo &) { ++count; });
+        REQUIRE(!truncated.success);
+        REQUIRE(2 == count);
+    }
+
+    SECTION("ForEachInJsonArray requires an array")
+    {
+        auto status = bound::ForEachInJsonArray<Foo>("{\"value\":1}", [](Foo &) {});
+        REQUIRE(!status.success);
+        REQUIRE(0 == status.error_message().find("Expected an array"));
     }
 }
 
@@ -219,6 +602,90 @@ TEST_CASE("ToJsonFile", "[to_json_file]")
     }
 }
 
+TEST_CASE("ReadJsonLines", "[read_json_lines]")
+{
+    const std::string json = "{\"name\":\"a\",\"value\":1}\n{\"name\":\"b\",\"value\":2}\r\n\n{\"value\":3}\n";
+
+    SECTION("UpdateStatus ReadJsonLines(const std::string &json, F &&callback)")
+    {
+        std::vector<Named> seen;
+        auto status = bound::ReadJsonLines<Named>(json, [&](Named &named) {
+            seen.push_back(named);
+        });
+        REQUIRE(status.success);
+        REQUIRE(0 == status.error_message().length());
+        REQUIRE(3 == seen.size());
+        REQUIRE("a" == seen[0].name);
+        REQUIRE(2 == seen[1].value);
+        REQUIRE(3 == seen[2].value);
+    }
+
+    SECTION("UpdateStatus ReadJsonLinesFile(const std::string &path, F &&callback)")
+    {
+        const std::string path = "test_temp.json";
+        std::ofstream{path, std::ios::trunc} << json;
+
+        for (auto mode : {bound::FileReadMode::kStream, bound::FileReadMode::kMapped})
+        {
+            int sum = 0;
+            auto status = bound::ReadJsonLinesFile<Named>(
+                path, [&](const Named &named) { sum += named.value; }, mode);
+            REQUIRE(status.success);
+            REQUIRE(6 == sum);
+        }
+    }
+
+    SECTION("ReadJsonLines empty input")
+    {
+        int count = 0;
+        REQUIRE(bound::ReadJsonLines<Foo>("", [&](Foo &) { ++count; }).success);
+        REQUIRE(bound::ReadJsonLines<Foo>(" \n\n", [&](Foo &) { ++count; }).success);
+        REQUIRE(0 == count);
+    }
+
+    SECTION("ReadJsonLines reports the failing record")
+    {
+        int count = 0;
+        auto status = bound::ReadJsonLines<Foo>("{\"value\":1}\n{\"value\":}\n{\"value\":3}\n",
+                                                [&](Foo &) { ++count; });
+        REQUIRE(!status.success);
+        REQUIRE(2 == status.part_index);
+        REQUIRE(0 == status.error_message().find("Record 2: "));
+        REQUIRE(1 == count);
+    }
+}
+
+TEST_CASE("ToJsonLines", "[to_json_lines]")
+{
+    std::vector<Named> records = {{"a", 1}, {"b", 2}};
+    const std::string json = "{\"name\":\"a\",\"value\":1}\n{\"name\":\"b\",\"value\":2}\n";
+
+    SECTION("const std::string ToJsonLines(T &records)")
+    {
+        REQUIRE(json == bound::ToJsonLines(records));
+        // Prefixes would split records across lines
+        REQUIRE(json == bound::ToJsonLines(records, bound::WriteConfig().SetPrefix("  ")));
+    }
+
+    SECTION("const bool ToJsonLinesFile(T &records, const std::string &filename)")
+    {
+        const static std::string filename = "test_temp.json";
+        REQUIRE(bound::ToJsonLinesFile(records, filename));
+        REQUIRE(json == ReadFile(filename));
+
+        std::vector<Named> read;
+        REQUIRE(bound::ReadJsonLinesFile<Named>(filename, [&](Named &named) {
+                    read.push_back(named);
+                }).success);
+        REQUIRE(json == bound::ToJsonLines(read));
+    }
+
+    SECTION("ToJsonLinesFile no filename given")
+    {
+        REQUIRE(!bound::ToJsonLinesFile(records, bound::WriteConfig()));
+    }
+}
+
 } // namespace test_include_bound_tests_h_
 
 #endif
\ No newline at end of file
@@ -0,0 +1,102 @@
+#ifndef BOUND_FIELD_MASK_TESTS_HPP_
+#define BOUND_FIELD_MASK_TESTS_HPP_
+
+#include "tests.h"
+
+namespace bound_field_mask_tests_hpp_
+{
+
+struct Item
+{
+    int id = 0;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Item::id, "id"));
+};
+
+struct Order
+{
+    int id = 0;
+    std::string customer = "unset";
+    std::vector<Item> items;
+    Item primary;
+    std::map<std::string, bound::JsonRaw> other;
+    int count_ = 0;
+
+    void set_count(int count)
+    {
+        count_ = count;
+    }
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Order::id, "id"),
+        bound::property(&Order::customer, "customer"),
+        bound::property(&Order::items, "items"),
+        bound::property(&Order::primary, "primary"),
+        bound::property(&Order::set_count, "count"),
+        bound::property(&Order::other));
+};
+
+const char *kJson =
+    "{\"id\":7,\"customer\":\"ada\",\"items\":[{\"id\":1},{\"id\":2}],"
+    "\"primary\":{\"id\":3},\"count\":2,\"note\":\"fragile\"}";
+
+// Resolved while compiling
+constexpr bound::FieldMask<Order> kSummary{"id", "count"};
+static_assert(kSummary.Selected(0), "id is selected");
+static_assert(!kSummary.Selected(1), "customer is not selected");
+static_assert(kSummary.Selected(4), "count is selected");
+
+TEST_CASE("Field Mask Tests", "[field_mask_tests]")
+{
+    SECTION("Only selected properties are read")
+    {
+        Order order;
+        auto status = bound::read::FromJson(kJson, order, kSummary);
+        REQUIRE(status.success());
+        REQUIRE(7 == order.id);
+        REQUIRE(2 == order.count_);
+        REQUIRE("unset" == order.customer);
+        REQUIRE(order.items.empty());
+        REQUIRE(0 == order.primary.id);
+        REQUIRE(order.other.empty());
+    }
+
+    SECTION("Masks are built from runtime names")
+    {
+        bound::FieldMask<Order> fields;
+        for (const std::string &name : std::vector<std::string>{"items", "missing"})
+        {
+            fields.Add(name);
+        }
+
+        Order order;
+        REQUIRE(bound::read::FromJson(std::string(kJson), order, fields).success());
+        REQUIRE(0 == order.id);
+        REQUIRE(2 == order.items.size());
+        REQUIRE(2 == order.items[1].id);
+        REQUIRE(0 == order.primary.id);
+    }
+
+    SECTION("Other keys are kept only when selected")
+    {
+        Order order;
+        REQUIRE(bound::read::FromJson(kJson, order, bound::FieldMask<Order>{"primary"}.AddOtherKeys()).success());
+        REQUIRE(3 == order.primary.id);
+        REQUIRE(1 == order.other.size());
+        REQUIRE("\"fragile\"" == order.other["note"].value);
+        REQUIRE(order.items.empty());
+    }
+
+    SECTION("Skipped values are still checked for errors")
+    {
+        Order order;
+        auto status = bound::read::FromJson("{\"customer\":[1,}", order, kSummary);
+        REQUIRE(!status.success());
+        REQUIRE(bound::ReadError::kParse == status.error);
+    }
+}
+
+} // namespace bound_field_mask_tests_hpp_
+
+#endif
\ No newline at end of file
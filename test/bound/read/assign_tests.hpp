@@ -79,6 +79,22 @@ TEST_CASE("Assign Tests", "[assign_tests]")
         test<bound::JsonString, std::string>("foo", "foo");
         test<bound::JsonString, std::string>("bar", "bar");
     }
+    SECTION("StringRef")
+    {
+        const bound::read::StringRef value{"foo\0bar", 7};
+
+        std::string string_target;
+        REQUIRE(bound::read::Assign(string_target, value));
+        REQUIRE(std::string("foo\0bar", 7) == string_target);
+
+        bound::JsonString json_string_target;
+        REQUIRE(bound::read::Assign(json_string_target, value));
+        REQUIRE(std::string("foo\0bar", 7) == json_string_target.value);
+
+        int int_target = 0;
+        REQUIRE(!bound::read::Assign(int_target, value));
+    }
+
     SECTION("JsonString|double")
     {
         bound::JsonString target;
@@ -0,0 +1,241 @@
+#ifndef BOUND_READ_INCREMENTAL_READER_TESTS_HPP_
+#define BOUND_READ_INCREMENTAL_READER_TESTS_HPP_
+
+#include "tests.h"
+
+namespace bound_read_incremental_reader_tests_hpp_
+{
+
+struct Child
+{
+    std::string name;
+    std::vector<double> values;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Child::name, "name"),
+        bound::property(&Child::values, "values"));
+};
+
+struct Parent
+{
+    int id;
+    std::vector<Child> children;
+    bound::JsonRaw raw;
+    std::map<std::string, bound::JsonRaw> extra;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Parent::id, "id"),
+        bound::property(&Parent::children, "children"),
+        bound::property(&Parent::raw, "raw"),
+        bound::property(&Parent::extra));
+};
+
+const std::string kJson =
+    "{\"id\": 12345, \"children\": [{\"name\": \"first \\\"child\\\"\", \"values\": [1.5, -2e3]},"
+    " {\"name\": \"second\", \"values\": []}], \"raw\": {\"a\":[true,null]}, \"other\": \"kept\"}";
+
+TEST_CASE("Incremental Reader Tests", "[incremental_reader_tests]")
+{
+    Parent expected;
+    REQUIRE(bound::UpdateWithJson(expected, kJson).success);
+    const std::string expected_json = bound::ToJson(expected);
+
+    SECTION("Every split point reads as a whole document")
+    {
+        bool same = true;
+        for (std::size_t split = 0; split <= kJson.size(); ++split)
+        {
+            Parent parent;
+            bound::IncrementalReader<Parent> reader{parent};
+            reader.Feed(kJson.data(), split);
+            reader.Feed(kJson.substr(split));
+            auto status = reader.Finish();
+            same = same && status.success && expected_json == bound::ToJson(parent);
+        }
+        REQUIRE(same);
+    }
+
+    SECTION("One byte at a time")
+    {
+        Parent parent;
+        bound::IncrementalReader<Parent> reader{parent};
+        for (char c : kJson)
+        {
+            REQUIRE(reader.Feed(&c, 1));
+        }
+        auto status = reader.Finish();
+        REQUIRE(status.success);
+        REQUIRE(expected_json == bound::ToJson(parent));
+    }
+
+    SECTION("Truncated and trailing input fail")
+    {
+        Parent parent;
+        bound::IncrementalReader<Parent> truncated{parent};
+        truncated.Feed(kJson.data(), kJson.size() - 1);
+        REQUIRE(!truncated.Finish().success);
+
+        bound::IncrementalReader<Parent> trailing{parent};
+        trailing.Feed(kJson + " {}");
+        REQUIRE(!trailing.Finish().success);
+
+        bound::IncrementalReader<Parent> empty{parent};
+        REQUIRE(!empty.Finish().success);
+    }
+
+    SECTION("Feeding stops once the document fails")
+    {
+        Parent parent;
+        bound::IncrementalReader<Parent> reader{parent};
+        REQUIRE(!reader.Feed(std::string("{\"id\": \"not a number\"")));
+        REQUIRE(!reader.Feed(std::string(" ")));
+
+        auto status = reader.Finish();
+        REQUIRE(!status.success);
+        REQUIRE(0 < status.error_message().length());
+    }
+
+    SECTION("Values are read by the Feed completing them")
+    {
+        Parent parent;
+        parent.id = 0;
+        bound::IncrementalReader<Parent> reader{parent};
+        REQUIRE(reader.Feed(std::string("{\"id\": 7, \"children\": [{\"name\": \"a\"}, {\"na")));
+        REQUIRE(parent.id == 7);
+        REQUIRE(parent.children.size() == 2);
+        REQUIRE(parent.children[0].name == "a");
+
+        REQUIRE(reader.Feed(std::string("me\": \"b\"}]}")));
+        REQUIRE(parent.children[1].name == "b");
+        REQUIRE(reader.Finish().success);
+    }
+
+    SECTION("Trailing input fed after the document fails")
+    {
+        Parent parent;
+        bound::IncrementalReader<Parent> reader{parent};
+        REQUIRE(reader.Feed(kJson));
+        REQUIRE(reader.Feed(std::string(" /* done */ ")));
+        REQUIRE(reader.Feed(std::string("x")));
+
+        auto status = reader.Finish();
+        REQUIRE(!status.success);
+        REQUIRE(status.error == bound::ReadError::kParse);
+        REQUIRE(status.offset == kJson.size() + 12);
+    }
+
+    SECTION("Read with a config")
+    {
+        typedef bound::ReadConfig<bound::kReadComments | bound::kReadRejectDuplicateKeys> Strict;
+        const std::string commented =
+            "// parent\n{\"id\": /* first */ 1, \"children\": [{\"name\": \"c\" /* } */}],\n"
+            " \"raw\": [1, /* ] */ 2], \"other\": {\"k\": \"v\"}} // end";
+
+        bool same = true;
+        for (std::size_t split = 0; split <= commented.size(); ++split)
+        {
+            Parent parent;
+            bound::IncrementalReader<Parent, Strict> reader{parent};
+            reader.Feed(commented.data(), split);
+            reader.Feed(commented.substr(split));
+            auto status = reader.Finish();
+            same = same && status.success && parent.id == 1 && parent.children.size() == 1 &&
+                   parent.raw.value == "[1,2]" && parent.extra["other"].value == "{\"k\":\"v\"}";
+        }
+        REQUIRE(same);
+
+        Parent parent;
+        bound::IncrementalReader<Parent, Strict> duplicate{parent};
+        REQUIRE(!duplicate.Feed(std::string("{\"x\": 1, \"x\": 2")));
+        REQUIRE(duplicate.Finish().error == bound::ReadError::kDuplicateKey);
+
+        bound::IncrementalReader<Parent, bound::ReadConfig<0>> uncommented{parent};
+        uncommented.Feed(commented);
+        REQUIRE(!uncommented.Finish().success);
+    }
+
+    SECTION("Stops once filled")
+    {
+        typedef bound::ReadConfig<bound::kReadComments | bound::kReadStopWhenFilled> Filled;
+
+        Child child;
+        bound::IncrementalReader<Child, Filled> reader{child};
+        REQUIRE(reader.Feed(std::string("{\"values\": [1, 2], \"na")));
+        REQUIRE(reader.Feed(std::string("me\": \"n\", ")));
+        REQUIRE(reader.Feed(std::string("not json")));
+
+        auto status = reader.Finish();
+        REQUIRE(status.success);
+        REQUIRE(child.name == "n");
+        REQUIRE(child.values.size() == 2);
+        REQUIRE(status.offset == 30);
+    }
+
+    SECTION("Maps and skipped values one byte at a time")
+    {
+        const std::string json =
+            "{\"a\": {\"name\": \"x\", \"skipped\": {\"deep\": [[1], {\"b\": []}]}, \"values\": [3]},"
+            " \"b\": {\"name\": \"y\", \"values\": []}}";
+
+        std::map<std::string, Child> children;
+        children["old"].name = "cleared";
+        bound::IncrementalReader<std::map<std::string, Child>> reader{children};
+        for (char c : json)
+        {
+            REQUIRE(reader.Feed(&c, 1));
+        }
+
+        REQUIRE(reader.Finish().success);
+        REQUIRE(children.size() == 2);
+        REQUIRE(children["a"].name == "x");
+        REQUIRE(children["a"].values.size() == 1);
+        REQUIRE(children["b"].name == "y");
+    }
+
+    SECTION("A large string in small chunks")
+    {
+        // Each Feed scans only its own input, not the string so far
+        std::string name;
+        for (std::size_t i = 0; name.size() < (4u << 20); ++i)
+        {
+            name += i % 64 == 0 ? "\\\"" : "abcdefgh";
+        }
+
+        const std::string json = "{\"name\": \"" + name + "\", \"values\": [1]}";
+        const std::size_t kChunk = 4096;
+
+        Child child;
+        bound::IncrementalReader<Child> reader{child};
+        for (std::size_t i = 0; i < json.size(); i += kChunk)
+        {
+            REQUIRE(reader.Feed(json.data() + i, std::min(kChunk, json.size() - i)));
+        }
+
+        REQUIRE(reader.Finish().success);
+        REQUIRE(child.values.size() == 1);
+        REQUIRE(child.name.size() < name.size());
+        REQUIRE(child.name.find("abcdefgh\"abcdefgh") != std::string::npos);
+
+        std::string root;
+        bound::IncrementalReader<std::string> root_reader{root};
+        const std::string root_json = "\"" + name + "\"  ";
+        for (std::size_t i = 0; i < root_json.size(); i += kChunk)
+        {
+            REQUIRE(root_reader.Feed(root_json.data() + i, std::min(kChunk, root_json.size() - i)));
+        }
+
+        REQUIRE(root_reader.Finish().success);
+        REQUIRE(child.name == root);
+    }
+
+    SECTION("Destroyed without finishing")
+    {
+        Parent parent;
+        bound::IncrementalReader<Parent> reader{parent};
+        reader.Feed(std::string("{\"id\": 1"));
+    }
+}
+
+} // namespace bound_read_incremental_reader_tests_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,94 @@
+#ifndef BOUND_READ_JSON_POINTER_TESTS_HPP_
+#define BOUND_READ_JSON_POINTER_TESTS_HPP_
+
+#include "tests.h"
+
+namespace bound_read_json_pointer_tests_hpp_
+{
+
+struct Tenant
+{
+    int id;
+    std::string name;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Tenant::id, "id"),
+        bound::property(&Tenant::name, "name"));
+};
+
+const char *kJson =
+    "{\"data\":[1,{\"x\":[2]},3],"
+    "\"meta\":{\"skip\":{\"a\":[{},[]]},\"tenant\":{\"id\":42,\"name\":\"acme\"}},"
+    "\"a/b\":\"slash\",\"m~n\":\"tilde\",\"\":\"empty\"}";
+
+TEST_CASE("Json Pointer Tests", "[json_pointer_tests]")
+{
+    SECTION("Tokens are split and unescaped")
+    {
+        bound::read::JsonPointer pointer{"/a~1b/m~0n//0", 13};
+        REQUIRE(pointer.IsValid());
+
+        bound::read::StringRef token;
+        REQUIRE(pointer.Next(token));
+        REQUIRE(bound::read::JsonPointer::Matches(token, bound::read::StringRef{"a/b", 3}));
+        REQUIRE(!bound::read::JsonPointer::Matches(token, bound::read::StringRef{"a~1b", 4}));
+        REQUIRE(pointer.Next(token));
+        REQUIRE(bound::read::JsonPointer::Matches(token, bound::read::StringRef{"m~n", 3}));
+        REQUIRE(pointer.Next(token));
+        REQUIRE(0 == token.length);
+        REQUIRE(pointer.Next(token));
+
+        std::size_t index;
+        REQUIRE(bound::read::JsonPointer::ArrayIndex(token, index));
+        REQUIRE(0 == index);
+        REQUIRE(!pointer.Next(token));
+
+        REQUIRE(!bound::read::JsonPointer::ArrayIndex(bound::read::StringRef{"01", 2}, index));
+        REQUIRE(!bound::read::JsonPointer::ArrayIndex(bound::read::StringRef{"-", 1}, index));
+        REQUIRE(!bound::read::JsonPointer{"a", 1}.IsValid());
+        REQUIRE(!bound::read::JsonPointer{"/~2", 3}.IsValid());
+        REQUIRE(bound::read::JsonPointer{"", 0}.IsValid());
+    }
+
+    SECTION("Values are read at the pointer")
+    {
+        auto tenant = bound::ReadAt<Tenant>(kJson, "/meta/tenant");
+        REQUIRE(tenant.success);
+        REQUIRE(42 == tenant.instance.id);
+        REQUIRE("acme" == tenant.instance.name);
+
+        REQUIRE(42 == bound::ReadAt<int>(kJson, "/meta/tenant/id").instance);
+        REQUIRE(2 == bound::ReadAt<int>(std::string(kJson), "/data/1/x/0").instance);
+        REQUIRE(3 == bound::ReadAt<int>(kJson, "/data/2").instance);
+        REQUIRE("slash" == bound::ReadAt<std::string>(kJson, "/a~1b").instance);
+        REQUIRE("tilde" == bound::ReadAt<std::string>(kJson, "/m~0n").instance);
+        REQUIRE("empty" == bound::ReadAt<std::string>(kJson, "/").instance);
+        REQUIRE(3 == bound::ReadAt<std::vector<bound::JsonRaw>>(kJson, "/data").instance.size());
+        REQUIRE(7 == bound::ReadAt<int>("7", "").instance);
+    }
+
+    SECTION("Parsing stops at the end of the value")
+    {
+        auto status = bound::ReadAt<int>("{\"a\":[1,2], this is not json", "/a/1");
+        REQUIRE(status.success);
+        REQUIRE(2 == status.instance);
+
+        REQUIRE(bound::ReadError::kParse == bound::ReadAt<int>("{\"a\":[1,}", "/a/1").error);
+    }
+
+    SECTION("Missing values and malformed pointers fail")
+    {
+        REQUIRE(bound::ReadError::kNotFound == bound::ReadAt<int>(kJson, "/meta/nope").error);
+        REQUIRE(bound::ReadError::kNotFound == bound::ReadAt<int>(kJson, "/data/3").error);
+        REQUIRE(bound::ReadError::kNotFound == bound::ReadAt<int>(kJson, "/data/-").error);
+        REQUIRE(bound::ReadError::kNotFound == bound::ReadAt<int>(kJson, "/data/0/x").error);
+
+        auto invalid = bound::ReadAt<int>(kJson, "meta");
+        REQUIRE(bound::ReadError::kInvalidPointer == invalid.error);
+        REQUIRE("Invalid JSON Pointer." == invalid.error_message());
+    }
+}
+
+} // namespace bound_read_json_pointer_tests_hpp_
+
+#endif
\ No newline at end of file
@@ -0,0 +1,271 @@
+#ifndef BOUND_READ_PARALLEL_READER_TESTS_HPP_
+#define BOUND_READ_PARALLEL_READER_TESTS_HPP_
+
+#include <algorithm>
+#include <fstream>
+#include "tests.h"
+
+namespace bound_read_parallel_reader_tests_hpp_
+{
+
+struct Record
+{
+    int id;
+    std::string name;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Record::id, "id"),
+        bound::property(&Record::name, "name"));
+};
+
+// Enough lines for many chunks
+std::string Lines(int count)
+{
+    std::string json;
+    for (int i = 0; i < count; ++i)
+    {
+        json += "{\"id\":" + std::to_string(i) + ",\"name\":\"record " + std::to_string(i) + "\"}\n";
+    }
+    return json;
+}
+
+TEST_CASE("Parallel Reader Tests", "[parallel_reader_tests]")
+{
+    const int count = 20000;
+    const std::string json = Lines(count);
+
+    SECTION("Chunks end after a newline")
+    {
+        auto chunks = bound::read::SplitLines(json.data(), json.size(), 1000);
+        REQUIRE(1 < chunks.size());
+        REQUIRE(json.data() == chunks.front().begin);
+        REQUIRE(json.data() + json.size() == chunks.back().end);
+
+        for (std::size_t i = 0; i + 1 < chunks.size(); ++i)
+        {
+            REQUIRE('\n' == chunks[i].end[-1]);
+            REQUIRE(chunks[i].end == chunks[i + 1].begin);
+        }
+
+        // A last line without a newline is kept
+        auto unterminated = bound::read::SplitLines("{}\n{}", 5, 1);
+        REQUIRE(2 == unterminated.size());
+        REQUIRE(std::string("{}") == std::string(unterminated[1].begin, unterminated[1].end));
+    }
+
+    SECTION("Input order")
+    {
+        for (unsigned threads : {1u, 2u, 8u})
+        {
+            std::vector<int> ids;
+            auto status = bound::ReadJsonLinesParallel<Record>(
+                json, [&](Record &record) { ids.push_back(record.id); },
+                bound::ParallelOrder::kInput, threads);
+            REQUIRE(status.success);
+            REQUIRE(count == ids.size());
+
+            bool in_order = true;
+            for (int i = 0; i < count; ++i)
+            {
+                in_order = in_order && ids[i] == i;
+            }
+            REQUIRE(in_order);
+        }
+    }
+
+    SECTION("Completion order")
+    {
+        std::vector<int> ids;
+        auto status = bound::ReadJsonLinesParallel<Record>(
+            json, [&](Record &record) { ids.push_back(record.id); },
+            bound::ParallelOrder::kCompletion, 8);
+        REQUIRE(status.success);
+        std::sort(ids.begin(), ids.end());
+        REQUIRE(count == ids.size());
+        REQUIRE(0 == ids.front());
+        REQUIRE(count - 1 == ids.back());
+        REQUIRE(ids.end() == std::adjacent_find(ids.begin(), ids.end()));
+    }
+
+    SECTION("Errors stop at the first failing record in input order")
+    {
+        const std::string broken = Lines(10000) + "{\"id\":}\n" + Lines(10000) + "{\"id\":\"x\"}\n";
+        std::size_t delivered = 0;
+        auto status = bound::ReadJsonLinesParallel<Record>(
+            broken, [&](Record &) { ++delivered; },
+            bound::ParallelOrder::kInput, 8);
+        REQUIRE(!status.success);
+        REQUIRE(10000 == delivered);
+        REQUIRE(0 == status.error_message().find("Chunk at byte "));
+        REQUIRE(std::string::npos != status.error_message().find("Invalid value."));
+    }
+
+    SECTION("Files and empty input")
+    {
+        const std::string path = "test_temp.json";
+        std::ofstream{path, std::ios::trunc} << json;
+
+        long long sum = 0;
+        auto status = bound::ReadJsonLinesFileParallel<Record>(
+            path, [&](const Record &record) { sum += record.id; });
+        REQUIRE(status.success);
+        REQUIRE(static_cast<long long>(count) * (count - 1) / 2 == sum);
+
+        std::ofstream{path, std::ios::trunc};
+        REQUIRE(bound::ReadJsonLinesFileParallel<Record>(path, [](Record &) {}).success);
+        REQUIRE(bound::ReadJsonLinesParallel<Record>("", [](Record &) {}).success);
+
+        auto missing = bound::ReadJsonLinesFileParallel<Record>("missing.json", [](Record &) {});
+        REQUIRE("Unable to open file \"missing.json\"." == missing.error_message());
+    }
+}
+
+struct Element
+{
+    int id;
+    std::string name;
+    std::vector<std::vector<int>> grid;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Element::id, "id"),
+        bound::property(&Element::name, "name"),
+        bound::property(&Element::grid, "grid"));
+};
+
+// Strings hold the commas, brackets, and escaped quotes the index must step over
+std::string Elements(int count)
+{
+    std::string json = "[";
+    for (int i = 0; i < count; ++i)
+    {
+        json += std::string(i ? ",\n " : "") + "{\"id\":" + std::to_string(i) +
+                ",\"name\":\"a, [b\\\"], {c\",\"grid\":[[" + std::to_string(i) + ",1],[]]}";
+    }
+    return json + "]\n";
+}
+
+TEST_CASE("Parallel Array Tests", "[parallel_reader_tests]")
+{
+    const int count = 20000;
+    const std::string json = Elements(count);
+
+    SECTION("Chunks hold whole elements")
+    {
+        bound::read::ArrayIndex index{json.data(), json.size(), 1000};
+        auto &chunks = index.chunks();
+        REQUIRE(index.status().success());
+        REQUIRE(1 < chunks.size());
+        REQUIRE(0 == chunks.front().first);
+
+        for (std::size_t i = 0; i + 1 < chunks.size(); ++i)
+        {
+            REQUIRE(',' == *chunks[i].end);
+            REQUIRE(chunks[i].end + 1 == chunks[i + 1].begin);
+            REQUIRE(chunks[i].first < chunks[i + 1].first);
+        }
+        REQUIRE(']' == *chunks.back().end);
+    }
+
+    SECTION("Matches a serial read")
+    {
+        auto expected = bound::CreateWithJson<std::vector<Element>>(json);
+        REQUIRE(expected.success);
+
+        for (unsigned threads : {1u, 2u, 8u})
+        {
+            auto status = bound::CreateWithJsonParallel<std::vector<Element>>(json, threads);
+            REQUIRE(status.success);
+            REQUIRE(count == status.instance.size());
+
+            bool same = true;
+            for (int i = 0; i < count; ++i)
+            {
+                same = same && i == status.instance[i].id &&
+                       expected.instance[i].name == status.instance[i].name &&
+                       expected.instance[i].grid == status.instance[i].grid;
+            }
+            REQUIRE(same);
+        }
+    }
+
+    SECTION("Elements ahead of the first error are kept")
+    {
+        std::string broken = Elements(10000);
+        broken.replace(broken.size() - 2, 2, ",{\"id\":7,\"name\":}," + Elements(10000).substr(1));
+        auto expected = bound::CreateWithJson<std::vector<Element>>(broken);
+        auto status = bound::CreateWithJsonParallel<std::vector<Element>>(broken, 8);
+        REQUIRE(!status.success);
+        REQUIRE(expected.instance.size() == status.instance.size());
+        REQUIRE(7 == status.instance.back().id);
+        REQUIRE(0 == status.error_message().find("Element 10000 at byte "));
+        REQUIRE(std::string::npos != status.error_message().find("Invalid value."));
+
+        const std::string rejected = "[{\"id\":1},{\"id\":\"x\"},{\"id\":3}]";
+        auto serial = bound::CreateWithJson<std::vector<Element>>(rejected);
+        auto parallel = bound::CreateWithJsonParallel<std::vector<Element>>(rejected, 2);
+        REQUIRE(!parallel.success);
+        REQUIRE(serial.instance.size() == parallel.instance.size());
+
+        auto trailing = bound::CreateWithJsonParallel<std::vector<Element>>(json + "[]", 8);
+        REQUIRE(!trailing.success);
+        REQUIRE(count == trailing.instance.size());
+    }
+
+    SECTION("Truncated arrays match a serial read")
+    {
+        auto parse = [](const std::string &json) {
+            return bound::CreateWithJsonParallel<std::vector<int>>(json, 2);
+        };
+        REQUIRE(std::vector<int>{1, 2, 3, 4} == parse("[1,2,3,4").instance);
+        REQUIRE(std::vector<int>{1, 2} == parse("[1,2, ").instance);
+
+        const std::string elements = Elements(3);
+        bool same = true;
+        for (std::size_t length = 1; length < elements.size() - 2; ++length)
+        {
+            const std::string truncated = elements.substr(0, length);
+            auto serial = bound::CreateWithJson<std::vector<Element>>(truncated);
+            auto parallel = bound::CreateWithJsonParallel<std::vector<Element>>(truncated, 2);
+            // An element cut short fails within its own stream, so only
+            //  the error's code is compared
+            same = same && !parallel.success && serial.error == parallel.error &&
+                   serial.parse_error == parallel.parse_error &&
+                   bound::ToJson(serial.instance) == bound::ToJson(parallel.instance);
+        }
+        REQUIRE(same);
+    }
+
+    SECTION("Malformed arrays")
+    {
+        auto parse = [](const std::string &json) {
+            return bound::CreateWithJsonParallel<std::vector<int>>(json, 2);
+        };
+
+        REQUIRE(parse(" [ ] ").success);
+        REQUIRE(parse("[]").instance.empty());
+        REQUIRE(std::vector<int>{1, 2, 3} == parse("[1, 2,3]").instance);
+        REQUIRE(!parse("").success);
+        REQUIRE(!parse("{}").success);
+        REQUIRE(!parse("[1, 2").success);
+        REQUIRE(!parse("[1, 2] 3").success);
+        REQUIRE(!parse("[1,]").success);
+        REQUIRE(!parse("[,]").success);
+        REQUIRE(!parse("[1 2]").success);
+        REQUIRE("Expected an array. Offset 0." == parse("{}").error_message());
+    }
+
+    SECTION("Files")
+    {
+        const std::string path = "test_temp.json";
+        std::ofstream{path, std::ios::trunc} << json;
+
+        auto status = bound::CreateWithJsonFileParallel<std::vector<Element>>(path);
+        REQUIRE(status.success);
+        REQUIRE(count == status.instance.size());
+        REQUIRE(count - 1 == status.instance.back().id);
+    }
+}
+
+} // namespace bound_read_parallel_reader_tests_hpp_
+
+#endif
\ No newline at end of file
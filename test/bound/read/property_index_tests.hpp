@@ -0,0 +1,105 @@
+#ifndef BOUND_READ_PROPERTY_INDEX_TESTS_HPP_
+#define BOUND_READ_PROPERTY_INDEX_TESTS_HPP_
+
+#include "tests.h"
+
+namespace bound_read_property_index_tests_hpp_
+{
+
+struct Foo
+{
+private:
+    int gamma_;
+
+public:
+    int alpha;
+    int beta;
+    int bet;
+    std::map<std::string, bound::JsonRaw> addl_props;
+
+    int gamma() const
+    {
+        return gamma_;
+    }
+
+    void set_gamma(int gamma)
+    {
+        gamma_ = gamma;
+    }
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Foo::beta, "beta"),
+        bound::property(&Foo::gamma, "gamma"),
+        bound::property(&Foo::addl_props),
+        bound::property(&Foo::alpha, "alpha"),
+        bound::property(&Foo::set_gamma, "gamma"),
+        bound::property(&Foo::bet, "bet"),
+        bound::property(&Foo::alpha, "alpha"));
+};
+
+struct Empty
+{
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple();
+};
+
+TEST_CASE("Property Index Tests", "[property_index_tests]")
+{
+    using Index = bound::read::PropertyIndex<Foo>;
+
+    SECTION("Finds tuple index by key")
+    {
+        REQUIRE(0 == Index::Find("beta", 4));
+        REQUIRE(3 == Index::Find("alpha", 5));
+        REQUIRE(5 == Index::Find("bet", 3));
+    }
+
+    SECTION("Skips unassignable properties with the same name")
+    {
+        REQUIRE(4 == Index::Find("gamma", 5));
+    }
+
+    SECTION("Unknown keys")
+    {
+        REQUIRE(Index::kNotFound == Index::Find("delta", 5));
+        REQUIRE(Index::kNotFound == Index::Find("bets", 4));
+        REQUIRE(Index::kNotFound == Index::Find("", 0));
+        REQUIRE(Index::kNotFound == Index::Find("beta\0", 5));
+    }
+
+    SECTION("Sorted, unique keys")
+    {
+        REQUIRE(4 == Index::kTable.size);
+        for (std::size_t i = 1; i < Index::kTable.size; ++i)
+        {
+            const bound::read::PropertyKey &a = Index::kTable.keys[i - 1];
+            const bound::read::PropertyKey &b = Index::kTable.keys[i];
+            REQUIRE(bound::read::CompareKey(a.name, a.length, b.name, b.length) < 0);
+        }
+    }
+
+    SECTION("Dynamic properties index")
+    {
+        REQUIRE(2 == Index::kJsonPropsIndex);
+        REQUIRE(bound::read::PropertyIndex<Empty>::kNotFound ==
+                bound::read::PropertyIndex<Empty>::kJsonPropsIndex);
+        REQUIRE(bound::read::PropertyIndex<Empty>::kNotFound ==
+                bound::read::PropertyIndex<Empty>::Find("alpha", 5));
+    }
+
+    SECTION("Reads through the index")
+    {
+        Foo foo = bound::CreateWithJson<Foo>(
+                      "{\"alpha\":1,\"bet\":2,\"beta\":3,\"gamma\":4,\"delta\":5}")
+                      .instance;
+
+        REQUIRE(1 == foo.alpha);
+        REQUIRE(2 == foo.bet);
+        REQUIRE(3 == foo.beta);
+        REQUIRE(4 == foo.gamma());
+        REQUIRE("5" == foo.addl_props.at("delta").value);
+    }
+}
+
+} // namespace bound_read_property_index_tests_hpp_
+
+#endif
\ No newline at end of file
@@ -14,6 +14,13 @@ void TestReadRawJson(std::string &&json)
     REQUIRE(json == raw_json.value);
 }
 
+std::map<std::string, bound::JsonRaw> ReadRawMap(const std::string &json)
+{
+    std::map<std::string, bound::JsonRaw> raw;
+    REQUIRE(bound::read::FromJson(json, raw).success());
+    return raw;
+}
+
 TEST_CASE("Raw Json Reader Tests", "[raw_json_reader_tests]")
 {
 
@@ -73,6 +80,70 @@ TEST_CASE("Raw Json Reader Tests", "[raw_json_reader_tests]")
     {
         TestReadRawJson("[{\"Foo\":\"Bar\"}]");
     }
+
+    SECTION("Source bytes are kept")
+    {
+        TestReadRawJson("{ \"Foo\" : [ 1.10, 1e2 ] }");
+        TestReadRawJson("0.1000000000000000055511151231257827");
+        TestReadRawJson("\"\\u00e9\\n\"");
+    }
+
+    SECTION("Separators, comments, and trailing whitespace are trimmed")
+    {
+        auto raw = ReadRawMap(
+            "{\"a\" : /* note */ {\"x\": 1} , \"b\":\n// note\n[1, 2]\t}");
+        REQUIRE("{\"x\": 1}" == raw.at("a").value);
+        REQUIRE("[1, 2]" == raw.at("b").value);
+
+        bound::JsonRaw root;
+        REQUIRE(bound::read::FromJson("  [1, 2]  \n", root).success());
+        REQUIRE("[1, 2]" == root.value);
+    }
+
+    SECTION("Comments within values are removed")
+    {
+        auto raw = ReadRawMap(
+            "{\"raw\": {\"a\": 1 /* note */, \"b\": \"/* kept */ // kept\" // note\n}}");
+        REQUIRE("{\"a\": 1 , \"b\": \"/* kept */ // kept\" \n}" == raw.at("raw").value);
+
+        const std::string written = bound::ToJson(raw);
+        std::map<std::string, bound::JsonRaw> reread;
+        REQUIRE(bound::read::FromJson(written, reread, bound::ReadConfig<0>()).success());
+
+        std::map<std::string, bound::JsonLazy<std::map<std::string, int>>> lazy;
+        REQUIRE(bound::read::FromJson("{\"lazy\": {\"a\": /* note */ 1}}", lazy).success());
+        REQUIRE("{\"lazy\":{\"a\":  1}}" == bound::ToJson(lazy));
+    }
+
+    SECTION("File values spanning buffer refills")
+    {
+        const std::string json = "{\"a\": {\"x\": [1, 2, 3], \"y\": \"long string value\"}, \"b\": 10}";
+        const char *path = "test_temp.json";
+        FILE *file = fopen(path, "w");
+        fputs(json.c_str(), file);
+        fclose(file);
+
+        file = fopen(path, "r");
+        char buffer[8];
+        bound::read::Parser<bound::read::FileStream> parser{
+            bound::read::FileStream(file, buffer, sizeof(buffer))};
+        std::map<std::string, bound::JsonRaw> raw;
+        bound::read::ReadStatus status;
+        bound::read::Reader<bound::read::FileStream>{parser, status}.ReadDocument(raw);
+        fclose(file);
+
+        REQUIRE(status.success());
+        REQUIRE("{\"x\": [1, 2, 3], \"y\": \"long string value\"}" == raw.at("a").value);
+        REQUIRE("10" == raw.at("b").value);
+    }
+
+    SECTION("In situ values are rewritten")
+    {
+        std::string json = "{\"a\": { \"x\" : 1 }}";
+        std::map<std::string, bound::JsonRaw> raw;
+        REQUIRE(bound::read::FromJsonInsitu(&json[0], json.size(), raw).success());
+        REQUIRE("{\"x\":1}" == raw.at("a").value);
+    }
 }
 } // namespace bound_read_raw_json_reader_tests_hpp_
 
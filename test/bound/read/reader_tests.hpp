@@ -57,6 +57,60 @@ struct Info
         bound::property(&Info::name, "name"));
 };
 
+// Counts copies to show values are moved into containers and setters
+struct Counted
+{
+    static int copies;
+    int value = 0;
+
+    Counted() = default;
+    Counted(Counted &&) noexcept = default;
+    Counted &operator=(Counted &&) noexcept = default;
+
+    Counted(const Counted &other) : value{other.value}
+    {
+        ++copies;
+    }
+
+    Counted &operator=(const Counted &other)
+    {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Counted::value, "value"));
+};
+
+int Counted::copies = 0;
+
+struct Holder
+{
+    std::vector<Counted> items;
+    std::list<Counted> linked;
+    Counted single;
+    std::vector<int> moved;
+    std::vector<int> reserved;
+
+    void set_single(Counted value)
+    {
+        single = std::move(value);
+    }
+
+    void set_moved(std::vector<int> &&value)
+    {
+        moved = std::move(value);
+    }
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Holder::items, "items"),
+        bound::property(&Holder::linked, "linked"),
+        bound::property(&Holder::set_single, "single"),
+        bound::property(&Holder::set_moved, "moved"),
+        bound::property(&Holder::reserved, "reserved").Reserve(64));
+};
+
 struct Date
 {
     long timestamp_ms;
@@ -101,6 +155,12 @@ public:
         bound::property(&User::set_locked, "locked"));
 };
 
+// A stream the reader can neither scan nor capture from
+struct PlainStream : rapidjson::StringStream
+{
+    PlainStream(const char *json) : rapidjson::StringStream(json) {}
+};
+
 struct DynObject
 {
 
@@ -112,6 +172,20 @@ struct DynObject
         bound::property(&DynObject::addl_props));
 };
 
+struct Account
+{
+    std::string id;
+    int balance = 0;
+    Info owner;
+    std::map<std::string, int> limits;
+
+    constexpr static auto BOUND_PROPS_NAME = std::make_tuple(
+        bound::property(&Account::id, "id").Required(),
+        bound::property(&Account::balance, "balance").Required(),
+        bound::property(&Account::owner, "owner"),
+        bound::property(&Account::limits, "limits"));
+};
+
 TEST_CASE("Reader Tests", "[reader_tests]")
 {
     SECTION("User creation")
@@ -187,6 +261,34 @@ TEST_CASE("Reader Tests", "[reader_tests]")
         REQUIRE(1 == bound::CreateWithJson<int>("1").instance);
     }
 
+    SECTION("Numbers are range checked for their type")
+    {
+        REQUIRE(-128 == bound::CreateWithJson<int8_t>("-128").instance);
+        REQUIRE(!bound::CreateWithJson<int8_t>("128").success);
+        REQUIRE(255 == bound::CreateWithJson<uint8_t>("255").instance);
+        REQUIRE(!bound::CreateWithJson<uint8_t>("-1").success);
+        REQUIRE(!bound::CreateWithJson<uint16_t>("65536").success);
+        REQUIRE(!bound::CreateWithJson<int>("2147483648").success);
+        REQUIRE(!bound::CreateWithJson<unsigned>("-1").success);
+        REQUIRE(INT64_MIN == bound::CreateWithJson<int64_t>("-9223372036854775808").instance);
+        REQUIRE(!bound::CreateWithJson<int64_t>("9223372036854775808").success);
+        REQUIRE(UINT64_MAX == bound::CreateWithJson<uint64_t>("18446744073709551615").instance);
+
+        // Whole numbers in floating point notation fit integers
+        REQUIRE(1000 == bound::CreateWithJson<int>("1e3").instance);
+        REQUIRE(!bound::CreateWithJson<int>("1.5").success);
+        REQUIRE(!bound::CreateWithJson<int64_t>("1e19").success);
+
+        REQUIRE(1.5f == bound::CreateWithJson<float>("1.5").instance);
+        REQUIRE(3.0 == bound::CreateWithJson<double>("3").instance);
+        REQUIRE(!bound::CreateWithJson<float>("1e39").success);
+        REQUIRE(bound::CreateWithJson<double>("1e39").success);
+
+        auto status = bound::CreateWithJson<int8_t>("300");
+        REQUIRE(0 == status.error_message().find("Number out of range for type"));
+        REQUIRE(!bound::CreateWithJson<int>("\"1\"").success);
+    }
+
     SECTION("string")
     {
         REQUIRE("value" == bound::CreateWithJson<std::string>("\"value\"").instance);
@@ -251,6 +353,351 @@ TEST_CASE("Reader Tests", "[reader_tests]")
         REQUIRE("{\"race\":\"purple\"}" == o.addl_props.at("demographics").value);
     }
 
+    SECTION("Strings with embedded nulls")
+    {
+        using Json = std::map<std::string, std::string>;
+        Json item = bound::CreateWithJson<Json>("{\"a\\u0000b\":\"c\\u0000d\"}").instance;
+        REQUIRE(std::string("c\0d", 3) == item.at(std::string("a\0b", 3)));
+
+        DynObject o = bound::CreateWithJson<DynObject>(
+                          "{\"name\":\"x\\u0000y\",\"name\\u0000\":\"z\"}")
+                          .instance;
+        REQUIRE(std::string("x\0y", 3) == o.name);
+        REQUIRE("\"z\"" == o.addl_props.at(std::string("name\0", 5)).value);
+
+        // Written back whole
+        REQUIRE("{\"a\\u0000b\":\"c\\u0000d\"}" == bound::ToJson(item));
+        REQUIRE("{\"name\":\"x\\u0000y\",\"name\\u0000\":\"z\"}" == bound::ToJson(o));
+    }
+
+    SECTION("Duplicate map keys replace the previous value")
+    {
+        using Json = std::map<std::string, std::vector<int>>;
+        Json item = bound::CreateWithJson<Json>("{\"a\":[1,2],\"b\":[3],\"a\":[4]}").instance;
+        REQUIRE(2 == item.size());
+        REQUIRE(std::vector<int>{4} == item.at("a"));
+        REQUIRE(std::vector<int>{3} == item.at("b"));
+    }
+
+    SECTION("Elements and setter values are moved, not copied")
+    {
+        Counted::copies = 0;
+        Holder holder;
+        auto status = bound::UpdateWithJson(
+            holder,
+            "{"
+            "\"items\":[{\"value\":1},{\"value\":2},{\"value\":3}],"
+            "\"linked\":[{\"value\":4}],"
+            "\"single\":{\"value\":5},"
+            "\"moved\":[6,7]"
+            "}");
+        REQUIRE(status.success);
+        REQUIRE(3 == holder.items.size());
+        REQUIRE(3 == holder.items.back().value);
+        REQUIRE(4 == holder.linked.front().value);
+        REQUIRE(5 == holder.single.value);
+        REQUIRE(std::vector<int>{6, 7} == holder.moved);
+        REQUIRE(0 == Counted::copies);
+    }
+
+    SECTION("Failed elements are not kept")
+    {
+        Holder holder;
+        REQUIRE(!bound::UpdateWithJson(holder, "{\"items\":[{\"value\":1},{\"value\":\"x\"}]}").success);
+        REQUIRE(1 == holder.items.size());
+    }
+
+    SECTION("Reserved properties")
+    {
+        Holder holder;
+        REQUIRE(bound::UpdateWithJson(holder, "{\"reserved\":[1,2,3]}").success);
+        REQUIRE(3 == holder.reserved.size());
+        REQUIRE(64 <= holder.reserved.capacity());
+    }
+
+    SECTION("vector<bool>")
+    {
+        std::vector<bool> flags;
+        REQUIRE(bound::read::FromJson("[true,false,true]", flags).success());
+        REQUIRE(std::vector<bool>{true, false, true} == flags);
+    }
+
+    SECTION("Unknown values are skipped")
+    {
+        const std::string json =
+            "{\"a\":{\"s\":\"} ] \\\" {\",\"n\":[1,[2,{}],\"]\"]},"
+            "\"b\":[/* ] */ {}, // }\n 3],"
+            "\"name\":\"kept\"}";
+
+        Info info;
+        REQUIRE(bound::read::FromJson(json, info).success());
+        REQUIRE("kept" == info.name);
+
+        std::string insitu = json;
+        info.name.clear();
+        REQUIRE(bound::read::FromJsonInsitu(&insitu[0], insitu.size(), info).success());
+        REQUIRE("kept" == info.name);
+
+        // Configs asking for checks scanning can't make tokenize instead
+        REQUIRE(bound::ReadError::kParse == bound::read::FromJson(json, info, bound::ReadConfig<0>()).error);
+        REQUIRE(bound::read::FromJson("{\"a\":[{}, 3],\"name\":\"x\"}", info, bound::ReadConfig<0>()).success());
+
+        using Validating = bound::ReadConfig<bound::kReadComments | bound::kReadValidateEncoding>;
+        const std::string invalid = "{\"a\":[\"\xff\"],\"name\":\"x\"}";
+        REQUIRE(bound::read::FromJson(invalid, info).success());
+        REQUIRE(bound::ReadError::kParse == bound::read::FromJson(invalid, info, Validating()).error);
+
+        // Long enough for vector scans, starting at every alignment
+        const std::string filler(100, 'x');
+        for (std::size_t offset = 0; offset < 32; ++offset)
+        {
+            const std::string padded = std::string(offset, ' ') +
+                                       "{\"a\":[\"" + filler + "\\\"\",{\"b\":\"" + filler + "\"}],\"name\":\"x\"}";
+            info.name.clear();
+            REQUIRE(bound::read::FromJson(padded, info).success());
+            REQUIRE("x" == info.name);
+        }
+
+        // Files are scanned a buffer at a time
+        const char *path = "test_temp.json";
+        FILE *file = fopen(path, "w");
+        fputs(json.c_str(), file);
+        fclose(file);
+
+        file = fopen(path, "r");
+        char buffer[8];
+        bound::read::Parser<bound::read::FileStream> parser{
+            bound::read::FileStream(file, buffer, sizeof(buffer))};
+        bound::read::ReadStatus status;
+        info.name.clear();
+        bound::read::Reader<bound::read::FileStream>{parser, status}.ReadDocument(info);
+        fclose(file);
+        REQUIRE(status.success());
+        REQUIRE("kept" == info.name);
+    }
+
+    SECTION("Parse errors are reported")
+    {
+        Info info;
+        auto empty = bound::read::FromJson("", info);
+        REQUIRE(!empty.success());
+        REQUIRE(0 == empty.error_message().find("The document is empty."));
+
+        // Skipped values are scanned for brackets, not validated, but an
+        //  unbalanced one leaves the document unfinished
+        auto skipped = bound::read::FromJson("{\"other\":{\"a\":[}}", info);
+        REQUIRE(!skipped.success());
+        REQUIRE(0 < skipped.error_message().length());
+    }
+
+    SECTION("Errors carry a code and position")
+    {
+        Info info;
+        auto ok = bound::read::FromJson("{\"name\":\"x\"}", info);
+        REQUIRE(bound::ReadError::kNone == ok.error);
+        REQUIRE(ok.error_message().empty());
+
+        auto empty = bound::read::FromJson("", info);
+        REQUIRE(bound::ReadError::kParse == empty.error);
+        REQUIRE(rapidjson::kParseErrorDocumentEmpty == empty.parse_error);
+
+        Counted counted;
+        const std::string json = "{\"value\":\n  \"x\"}";
+        auto wrong_type = bound::read::FromJson(json, counted);
+        REQUIRE(bound::ReadError::kCannotAssign == wrong_type.error);
+        REQUIRE(15 == wrong_type.offset);
+        REQUIRE(2 == wrong_type.position(json.c_str()).line);
+        REQUIRE(6 == wrong_type.position(json.c_str()).column);
+        REQUIRE(1 == wrong_type.depth);
+        REQUIRE(bound::read::Event::kTypeString == wrong_type.event_type);
+        REQUIRE(std::string(typeid(int).name()) == wrong_type.type_name);
+        REQUIRE(std::string::npos != wrong_type.error_message().find(
+                                         "with event {\"type\":\"String\"}. Offset 15."));
+
+        // In situ sources are decoded over, so are located in the original
+        std::string insitu = json;
+        auto insitu_status = bound::read::FromJsonInsitu(&insitu[0], insitu.size(), counted);
+        REQUIRE(bound::ReadError::kCannotAssign == insitu_status.error);
+        REQUIRE(15 == insitu_status.offset);
+        REQUIRE(2 == insitu_status.position(json.c_str()).line);
+
+        uint8_t small;
+        auto out_of_range = bound::read::FromJson("300", small);
+        REQUIRE(bound::ReadError::kOutOfRange == out_of_range.error);
+        REQUIRE(300 == out_of_range.event_value.int_value);
+
+        std::vector<int> list;
+        REQUIRE(bound::ReadError::kUnexpectedEvent == bound::read::FromJson("{\"a\":1}", list).error);
+        REQUIRE(bound::ReadError::kFileOpen == bound::read::FromJsonFile("missing.json", list).error);
+
+        // rapidjson rejects a key after a key first, so build the status
+        bound::read::ReadStatus unassigned;
+        unassigned.error = bound::ReadError::kUnassignedKey;
+        unassigned.key_offset = 7;
+        unassigned.offset = 12;
+        REQUIRE("Unassigned key at offset 7; found new key. Offset 12." == unassigned.error_message());
+        unassigned.property_name = "name";
+        REQUIRE("Unassigned key \"name\" at offset 7; found new key. Offset 12." == unassigned.error_message());
+    }
+
+    SECTION("Top-level objects can stop once filled")
+    {
+        using Filled = bound::ReadConfig<bound::kReadComments | bound::kReadStopWhenFilled>;
+
+        // The trailing values are never parsed, so aren't validated either
+        const std::string json = "{\"info\":{\"name\":\"ann\"},\"extra\":[1,2],\"birthdate\":5,"
+                                 "\"aliases\":[\"a\"],\"locked\":false,\"rest\":[1,2,3], not json";
+        User user;
+        auto status = bound::read::FromJson(json, user, Filled());
+        REQUIRE(status.success());
+        REQUIRE("ann" == user.info.name);
+        REQUIRE(5 == user.birthdate.timestamp_ms);
+        REQUIRE(!user.locked());
+        REQUIRE(json.find(",\"rest\"") == status.offset);
+        REQUIRE(json.size() - status.offset == status.unread);
+
+        // Measuring a null terminated tail would mean scanning it
+        status = bound::read::FromJson(json.c_str(), user, Filled());
+        REQUIRE(status.success());
+        REQUIRE(json.find(",\"rest\"") == status.offset);
+        REQUIRE(0 == status.unread);
+
+        bound::BasicReadContext<Filled> context;
+        auto update = bound::UpdateWithJson(context, user, json);
+        REQUIRE(update.success);
+        REQUIRE(json.size() - update.offset == update.unread);
+
+        // Nested objects are read whole
+        std::string insitu = "{\"info\":{\"name\":\"bo\",\"x\":1},\"birthdate\":6,"
+                             "\"aliases\":[],\"locked\":true}  ";
+        const std::size_t length = insitu.size();
+        status = bound::read::FromJsonInsitu(&insitu[0], length, user, Filled());
+        REQUIRE(status.success());
+        REQUIRE("bo" == user.info.name);
+        REQUIRE(length - 1 - 2 == status.offset);
+        REQUIRE(3 == status.unread);
+
+        // A missing property reads to the end
+        status = bound::read::FromJson("{\"birthdate\":7,\"locked\":true}", user, Filled());
+        REQUIRE(status.success());
+        REQUIRE(0 == status.unread);
+        REQUIRE(7 == user.birthdate.timestamp_ms);
+
+        // Keys after the properties may still belong in a dynamic properties
+        //  map, unless a mask leaves it out
+        DynObject dyn;
+        const std::string dyn_json = "{\"name\":\"n\",\"extra\":1}";
+        status = bound::read::FromJson(dyn_json, dyn, Filled());
+        REQUIRE(status.success());
+        REQUIRE("1" == dyn.addl_props.at("extra").value);
+        REQUIRE(0 == status.offset);
+
+        dyn.addl_props.clear();
+        status = bound::read::FromJson(dyn_json, dyn, bound::FieldMask<DynObject>{"name"}, Filled());
+        REQUIRE(status.success());
+        REQUIRE(dyn.addl_props.empty());
+        REQUIRE(dyn_json.find(",\"extra\"") == status.offset);
+
+        // Only selected properties need be set
+        status = bound::read::FromJson(json, user, bound::FieldMask<User>{"info"}, Filled());
+        REQUIRE(status.success());
+        REQUIRE(json.find(",\"extra\"") == status.offset);
+    }
+
+    SECTION("Required properties and duplicate keys")
+    {
+        Account account;
+        auto status = bound::read::FromJson("{\"balance\":3,\"id\":\"a\"}", account);
+        REQUIRE(status.success());
+        REQUIRE("a" == account.id);
+
+        status = bound::read::FromJson("{\"id\":\"a\",\"owner\":{\"name\":\"ann\"}}", account);
+        REQUIRE(bound::ReadError::kMissingProperty == status.error);
+        REQUIRE("Missing required property \"balance\". Offset 33." ==
+                status.error_message());
+
+        // Checked in nested objects too
+        std::vector<Account> accounts;
+        status = bound::read::FromJson("[{\"id\":\"a\",\"balance\":1},{\"balance\":2}]", accounts);
+        REQUIRE(bound::ReadError::kMissingProperty == status.error);
+        REQUIRE(std::string("id") == status.property_name);
+
+        // Unselected properties aren't required
+        status = bound::read::FromJson("{\"id\":\"b\"}", account, bound::FieldMask<Account>{"id"});
+        REQUIRE(status.success());
+        REQUIRE("b" == account.id);
+
+        // The last duplicate wins by default
+        status = bound::read::FromJson("{\"id\":\"a\",\"balance\":1,\"id\":\"c\"}", account);
+        REQUIRE(status.success());
+        REQUIRE("c" == account.id);
+
+        using Strict = bound::ReadConfig<bound::kReadComments | bound::kReadRejectDuplicateKeys>;
+        status = bound::read::FromJson("{\"id\":\"a\",\"balance\":1,\"id\":\"c\"}", account, Strict());
+        REQUIRE(bound::ReadError::kDuplicateKey == status.error);
+        REQUIRE(0 == status.error_message().find("Duplicate key \"id\"."));
+
+        status = bound::read::FromJson("{\"id\":\"a\",\"balance\":1,\"limits\":{\"x\":1,\"x\":2}}",
+                                       account, Strict());
+        REQUIRE(bound::ReadError::kDuplicateKey == status.error);
+        REQUIRE(0 == status.error_message().find("Duplicate key."));
+
+        status = bound::read::FromJson("{\"id\":\"a\",\"balance\":1,\"limits\":{\"x\":1,\"y\":2}}",
+                                       account, Strict());
+        REQUIRE(status.success());
+        REQUIRE(2 == account.limits.at("y"));
+
+        // Keys kept by the dynamic properties map from an earlier read aren't
+        //  duplicates of the next
+        DynObject dyn;
+        const std::string dyn_json = "{\"name\":\"n\",\"extra\":1}";
+        REQUIRE(bound::UpdateWithJson(dyn, dyn_json, Strict()).success);
+        REQUIRE(bound::UpdateWithJson(dyn, dyn_json, Strict()).success);
+        REQUIRE("1" == dyn.addl_props.at("extra").value);
+
+        status = bound::read::FromJson("{\"extra\":1,\"name\":\"n\",\"extra\":2}", dyn, Strict());
+        REQUIRE(bound::ReadError::kDuplicateKey == status.error);
+        REQUIRE(nullptr == status.property_name);
+    }
+
+    SECTION("Nesting depth is bounded")
+    {
+        using Shallow = bound::ReadConfig<bound::kReadComments, 2>;
+        std::vector<std::vector<int>> nested;
+        REQUIRE(bound::read::FromJson("[[1]]", nested, Shallow()).success());
+
+        auto status = bound::read::FromJson("[[[1]]]", nested, Shallow());
+        REQUIRE(!status.success());
+        REQUIRE(0 == status.error_message().find("Nesting deeper than 2 objects and arrays. Offset 3."));
+
+        // Rejected rather than exhausting the stack, whether bound, skipped,
+        //  or kept raw
+        const std::string deep = std::string(100000, '[') + std::string(100000, ']');
+        const std::string message = "Nesting deeper than " + std::to_string(BOUND_READ_MAX_DEPTH);
+
+        std::vector<bound::JsonRaw> raw;
+        REQUIRE(0 == bound::read::FromJson(deep, raw).error_message().find(message));
+
+        std::string insitu = deep;
+        REQUIRE(0 == bound::read::FromJsonInsitu(&insitu[0], insitu.size(), raw).error_message().find(message));
+
+        // A stream which can't be scanned skips a token at a time
+        const std::string deep_other = "{\"other\":" + deep + "}";
+        bound::read::Parser<PlainStream> parser{PlainStream(deep_other.c_str())};
+        Info info;
+        bound::read::ReadStatus skipped;
+        bound::read::Reader<PlainStream>{parser, skipped}.ReadDocument(info);
+        REQUIRE(0 == skipped.error_message().find(message));
+
+        const std::string allowed = std::string(BOUND_READ_MAX_DEPTH - 1, '[') + std::string(BOUND_READ_MAX_DEPTH - 1, ']');
+        const std::string allowed_other = "{\"other\":" + allowed + ",\"name\":\"x\"}";
+        bound::read::Parser<PlainStream> allowed_parser{PlainStream(allowed_other.c_str())};
+        bound::read::ReadStatus skipped_allowed;
+        bound::read::Reader<PlainStream>{allowed_parser, skipped_allowed}.ReadDocument(info);
+        REQUIRE(skipped_allowed.success());
+        REQUIRE("x" == info.name);
+    }
+
     SECTION("bound::JsonString")
     {
 
@@ -50,12 +50,25 @@ TEST_CASE("Type Trait Tests", "[type_trait_tests]")
         REQUIRE(bound::is_seq_container<std::list<int>>::value);
         REQUIRE(bound::is_seq_container<std::vector<Bound>>::value);
         REQUIRE(bound::is_seq_container<std::deque<Unbound>>::value);
+        REQUIRE(bound::is_seq_container<bound::ArenaVector<int>>::value);
+        REQUIRE(bound::is_seq_container<std::list<int, bound::ArenaAllocator<int>>>::value);
 
         REQUIRE(!bound::is_seq_container<std::map<std::string, int>>::value);
         REQUIRE(!bound::is_seq_container<std::map<std::string, Bound>>::value);
         REQUIRE(!bound::is_seq_container<std::map<std::string, Unbound>>::value);
     }
 
+    SECTION("is_reservable")
+    {
+        REQUIRE(!bound::is_reservable<int>::value);
+        REQUIRE(!bound::is_reservable<std::list<int>>::value);
+        REQUIRE(!bound::is_reservable<std::deque<Bound>>::value);
+
+        REQUIRE(bound::is_reservable<std::vector<int>>::value);
+        REQUIRE(bound::is_reservable<std::vector<Bound>>::value);
+        REQUIRE(bound::is_reservable<bound::ArenaVector<Bound>>::value);
+    }
+
     SECTION("is_json_properties")
     {
         REQUIRE(!bound::is_json_properties<Bound>::value);
@@ -69,6 +82,16 @@ TEST_CASE("Type Trait Tests", "[type_trait_tests]")
         REQUIRE(bound::is_json_properties<std::map<std::string, int>>::value);
         REQUIRE(bound::is_json_properties<std::map<std::string, Bound>>::value);
         REQUIRE(bound::is_json_properties<std::map<std::string, Unbound>>::value);
+        REQUIRE(bound::is_json_properties<bound::ArenaMap<int>>::value);
+        REQUIRE(!bound::is_json_properties<std::map<int, int>>::value);
+    }
+
+    SECTION("is_string")
+    {
+        REQUIRE(bound::is_string<std::string>::value);
+        REQUIRE(bound::is_string<bound::ArenaString>::value);
+        REQUIRE(!bound::is_string<std::wstring>::value);
+        REQUIRE(!bound::is_string<const char *>::value);
     }
 
     SECTION("is_int")
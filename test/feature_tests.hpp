@@ -192,6 +192,47 @@ TEST_CASE("Supported Types", "[supported_types]")
         test(v, "\"foo\"");
         test(v, "[\"foo\"]");
     }
+
+    SECTION("bound::JsonLazy")
+    {
+        const std::string json = "{\"bar\":{\"bar\":[1, 2],\"unknown\":{}}}";
+        auto foo = bound::CreateWithJson<Foo<bound::JsonLazy<Foo<std::vector<int>>>>>(json).instance;
+        REQUIRE(!foo.bar.parsed());
+        REQUIRE("{\"bar\":[1, 2],\"unknown\":{}}" == foo.bar.source());
+
+        // Unparsed values are written as read
+        REQUIRE(json == bound::ToJson(foo));
+
+        REQUIRE(std::vector<int>{1, 2} == foo.bar.Get().bar);
+        REQUIRE(foo.bar.parsed());
+        REQUIRE(foo.bar.error_message().empty());
+
+        // The cached value is written once parsed
+        foo.bar.Get().bar.push_back(3);
+        REQUIRE("{\"bar\":{\"bar\":[1,2,3],\"unknown\":{}}}" == bound::ToJson(foo));
+
+        // Contents are only read on access
+        bound::JsonLazy<Foo<int>> lazy;
+        REQUIRE(bound::UpdateWithJson(lazy, "{\"bar\":[1]}").success);
+        REQUIRE(!lazy.parsed());
+        lazy.Get();
+        REQUIRE(!lazy.error_message().empty());
+
+        lazy = Foo<int>{17};
+        REQUIRE(lazy.parsed());
+        REQUIRE(17 == lazy.Get().bar);
+
+        // Parsed with the config the document was read with
+        using Nested = Foo<bound::JsonLazy<Foo<std::vector<std::vector<int>>>>>;
+        const std::string nested = "{\"bar\":{\"bar\":[[1]]}}";
+        auto shallow = bound::CreateWithJson<Nested>(nested, bound::ReadConfig<bound::kReadComments, 2>());
+        REQUIRE(shallow.success);
+        shallow.instance.bar.Get();
+        REQUIRE(!shallow.instance.bar.error_message().empty());
+
+        auto deep = bound::CreateWithJson<Nested>(nested).instance;
+        REQUIRE(1 == deep.bar.Get().bar.at(0).at(0));
+    }
 }
 
 TEST_CASE("Property Declaration", "[property_declaration]")
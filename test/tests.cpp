@@ -1,9 +1,15 @@
 #include "tests.h"
 #include "bound/bound_tests.h"
 #include "bound/type_trait_tests.h"
+#include "bound/arena_tests.hpp"
+#include "bound/field_mask_tests.hpp"
 #include "bound/write/writer_tests.hpp"
 #include "bound/read/assign_tests.hpp"
 #include "bound/read/reader_tests.hpp"
+#include "bound/read/property_index_tests.hpp"
 #include "bound/read/raw_json_reader_tests.hpp"
+#include "bound/read/parallel_reader_tests.hpp"
+#include "bound/read/incremental_reader_tests.hpp"
+#include "bound/read/json_pointer_tests.hpp"
 #include "bound/write/scanner_tests.hpp"
 #include "feature_tests.hpp"
\ No newline at end of file